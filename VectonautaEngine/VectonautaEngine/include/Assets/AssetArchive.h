@@ -0,0 +1,143 @@
+#pragma once
+
+/**
+ * @file AssetArchive.h
+ * @brief Declares AssetArchive, a packed file of pre-decoded textures read through a memory mapping.
+ */
+
+#include "../Prerequisites.h"
+#include "Utilities/MappedFile.h"
+
+/**
+ * @class AssetArchive
+ * @brief Read-only archive of RGBA textures with a hashed table of contents.
+ *
+ * Layout (little endian):
+ *   Header     magic "VAPK", version, entry count, reserved.
+ *   TOC        one TocEntry per asset, sorted by the 64-bit FNV-1a hash of its key.
+ *   Names      key strings, used to resolve hash collisions.
+ *   Pixels     width * height * 4 bytes per asset, 16-byte aligned.
+ *
+ * Keys follow the ResourceManager convention: the file path without its extension
+ * ("Sprites/Mario"). Lookups are a binary search over the mapped TOC and return pointers into
+ * the mapping, so pixels are not copied until they are uploaded to the GPU.
+ */
+class
+  AssetArchive {
+public:
+  /**
+   * @struct TextureView
+   * @brief Pixels of one texture, pointing into the mapped archive.
+   */
+  struct
+    TextureView {
+    const uint8_t* pixels = nullptr; ///< RGBA pixels, row by row.
+    uint32_t width = 0;              ///< Width in pixels.
+    uint32_t height = 0;             ///< Height in pixels.
+  };
+
+  static constexpr uint32_t MAGIC = 0x4B504156;  ///< "VAPK" read as a little endian uint32.
+  static constexpr uint32_t VERSION = 1;         ///< Current format version.
+
+  /**
+   * @brief Default constructor. No archive is open.
+   */
+  AssetArchive() = default;
+
+  /**
+   * @brief Destructor. Unmaps the archive.
+   */
+  ~AssetArchive() = default;
+
+  AssetArchive(const AssetArchive&) = delete;
+  AssetArchive& operator=(const AssetArchive&) = delete;
+
+  /**
+   * @brief Maps an archive and validates its header and table of contents.
+   * @param path Archive file.
+   * @return false if the file is missing or not a valid archive.
+   */
+  bool
+    open(const std::string& path);
+
+  /**
+   * @brief Unmaps the archive.
+   */
+  void
+    close();
+
+  /**
+   * @brief Checks whether an archive is open.
+   */
+  bool
+    isOpen() const { return m_file.isOpen(); }
+
+  /**
+   * @brief Returns the number of assets in the archive.
+   */
+  uint32_t
+    getEntryCount() const { return m_entryCount; }
+
+  /**
+   * @brief Looks up a texture by key.
+   * @param key Path without extension, e.g. "Sprites/Mario".
+   * @param out Receives the pixels if found.
+   * @return true if the archive contains the key.
+   */
+  bool
+    findTexture(const std::string& key, TextureView& out) const;
+
+  /**
+   * @brief Hash used by the table of contents (64-bit FNV-1a).
+   */
+  static uint64_t
+    hashKey(const std::string& key);
+
+  /**
+   * @brief Decodes image files and writes them into a new archive (offline packer).
+   * @param files Image paths, absolute or relative to the working directory.
+   * @param root Asset root; each key is the file's path relative to it, without extension.
+   *             Use the directory the game runs from, so keys match ResourceManager names.
+   * @param outputPath Archive to create.
+   * @return false if a file is outside root, an image cannot be decoded or the archive cannot
+   *         be written.
+   */
+  static bool
+    pack(const std::vector<std::string>& files,
+         const std::string& root,
+         const std::string& outputPath);
+
+private:
+  /**
+   * @struct Header
+   * @brief First bytes of the archive.
+   */
+  struct
+    Header {
+    uint32_t magic;      ///< MAGIC.
+    uint32_t version;    ///< VERSION.
+    uint32_t entryCount; ///< Number of TocEntry records.
+    uint32_t reserved;   ///< Zero.
+  };
+
+  /**
+   * @struct TocEntry
+   * @brief Table of contents record of one asset.
+   */
+  struct
+    TocEntry {
+    uint64_t hash;       ///< hashKey() of the key.
+    uint64_t dataOffset; ///< Offset of the pixels from the start of the file.
+    uint32_t nameOffset; ///< Offset of the key from the start of the file.
+    uint32_t nameLength; ///< Key length in bytes.
+    uint32_t width;      ///< Width in pixels.
+    uint32_t height;     ///< Height in pixels.
+  };
+
+  static_assert(sizeof(Header) == 16, "AssetArchive header must be packed");
+  static_assert(sizeof(TocEntry) == 32, "AssetArchive TOC entry must be packed");
+
+  MappedFile m_file;                ///< Mapping of the whole archive.
+  const TocEntry* m_toc = nullptr;  ///< Table of contents inside the mapping.
+  uint32_t m_entryCount = 0;        ///< Number of entries.
+};
@@ -9,10 +9,73 @@
 #include "Window.h"
 #include "CShape.h" 
 #include "ECS/Actor.h"
+#include "ECS/ArchetypeStorage.h"
+#include "ECS/EntityRegistry.h"
+#include "ECS/Path.h"
+#include "ECS/SystemScheduler.h"
+#include "ECS/Systems/CollisionSystem.h"
+#include "ECS/Systems/RenderSystem.h"
+#include "ECS/Systems/SpatialGridSystem.h"
+#include "ECS/Systems/TransformSyncSystem.h"
+#include "Jobs/JobSystem.h"
+#include "Memory/FrameArena.h"
 
 #include <vector>
 #include <SFML/System/Vector2.hpp> // para sf::Vector2f
 
+/**
+ * @struct AppConfig
+ * @brief Options that control how BaseApp::run drives the main loop.
+ *
+ * The defaults give the interactive application. Setting headless, a frame count and a fixed
+ * timestep turns run() into a deterministic benchmark.
+ */
+struct
+  AppConfig {
+  static constexpr uint32_t DEFAULT_HEADLESS_FRAMES = 600; ///< Frame count main() gives --headless without --frames.
+
+  bool headless = false;     ///< Render off-screen without a frame limit.
+  uint32_t frameCount = 0;   ///< Frames to run before exiting (0 = until the window closes).
+  float fixedTimestep = 0.f; ///< Seconds each frame adds to the simulation (0 = measured delta time).
+  float tickRate = 60.f;     ///< Simulation ticks per second, independent of the frame rate.
+  uint32_t maxSubsteps = 5;  ///< Most ticks run in one frame; older time is dropped.
+  std::string assetArchive = "Assets.vpk"; ///< Packed assets; loose files are used if missing.
+  uint32_t crowdSize = 0;    ///< Extra actors spread along the track path next to Mario.
+  uint32_t churnPerFrame = 0;///< Crowd actors despawned and spawned again every frame.
+  bool pooling = true;       ///< Allocate actors and components from pools (MakePooledShared).
+  std::string profileOutput; ///< Chrome trace written after the loop (empty = no capture).
+};
+
+/**
+ * @struct FrameStats
+ * @brief Wall-clock time spent in each phase of the main loop.
+ */
+struct
+  FrameStats {
+  uint32_t frames = 0;       ///< Frames completed.
+  double totalSeconds = 0.0; ///< Time spent inside the loop.
+  double eventSeconds = 0.0; ///< Time spent handling window events.
+  double updateSeconds = 0.0;///< Time spent in update().
+  double renderSeconds = 0.0;///< Time spent in render().
+  uint64_t drawCalls = 0;    ///< Draw calls issued by the RenderSystem.
+  uint64_t shapes = 0;       ///< Shapes submitted to the RenderSystem's batch.
+  uint64_t ticks = 0;        ///< Fixed simulation ticks run.
+  uint64_t contacts = 0;     ///< Contacts found by the CollisionSystem, summed over ticks.
+  size_t arenaPeakBytes = 0; ///< Largest frame arena use in a single frame.
+  uint64_t arenaHeapAllocations = 0; ///< Times the frame arena fell back to the heap.
+  uint32_t arenaLastHeapFrame = 0;   ///< Last frame (1-based) in which it did, or 0.
+  SpatialGridStats grid;     ///< Rebuilds and syncs run by the SpatialGridSystem.
+  uint32_t gridEntities = 0; ///< Entities in the grid measured after the loop.
+  double gridRebuildSeconds = 0.0; ///< Average full rebuild of that grid, measured after the loop.
+  uint64_t gridQueries = 0;  ///< Radius queries run after the loop, one around each entity.
+  uint64_t gridQueryHits = 0;///< Entities returned by those queries.
+  double gridQuerySeconds = 0.0; ///< Time spent in those queries.
+  uint64_t respawns = 0;     ///< Crowd actors despawned and spawned again (AppConfig::churnPerFrame).
+  double churnSeconds = 0.0; ///< Time spent in those respawns.
+  uint64_t iteratedActors = 0;   ///< Actor visits in the iteration pass run after the loop.
+  double iterationSeconds = 0.0; ///< Time spent in that pass.
+};
+
  /**
   * @class BaseApp
   * @brief Core application class that controls initialization, the main loop, rendering, and cleanup.
@@ -27,6 +90,12 @@ public:
    */
   BaseApp() = default;
 
+  /**
+   * @brief Constructor with loop options (headless, frame count, fixed timestep).
+   * @param config Options used by run().
+   */
+  explicit BaseApp(const AppConfig& config) : m_config(config) {}
+
   /**
   * @brief Destructor that handles cleanup.
   */
@@ -50,10 +119,20 @@ public:
 
   /**
    * @brief Updates the application logic (called every frame).
+   *
+   * Adds the frame time to an accumulator and runs as many fixed ticks as fit in it,
+   * at most AppConfig::maxSubsteps.
    */
   void
     update();
 
+  /**
+   * @brief Advances the simulation by one fixed tick.
+   * @param dt Tick duration in seconds (1 / AppConfig::tickRate).
+   */
+  void
+    fixedUpdate(float dt);
+
   /**
    * @brief Renders all drawable objects to the screen.
    */
@@ -66,16 +145,71 @@ public:
   void
     destroy();
 
+  /**
+   * @brief Returns the timings collected by the last call to run().
+   */
+  const FrameStats&
+    getFrameStats() const { return m_frameStats; }
+
 private:
+  /**
+   * @brief Prints frames/sec and the average time of each loop phase.
+   */
+  void
+    reportFrameStats() const;
+
+  /**
+   * @brief Times full rebuilds of a SpatialGrid and one radius query around each entity,
+   * on the positions the loop ended with, and stores the results in m_frameStats.
+   */
+  void
+    measureSpatialGrid();
+
+  /**
+   * @brief Times a pass that reads the Transform and CShape of every actor through its
+   * component slots, like Actor::update, and stores the result in m_frameStats.
+   */
+  void
+    measureActorIteration();
+
+  /**
+   * @brief Spawns a crowd actor at its place along the track path.
+   * @param index Position of the actor in the crowd (0 .. crowdSize - 1).
+   * @return Handle of the new actor, or a null handle if the registry is full.
+   */
+  EntityHandle
+    spawnCrowdActor(uint32_t index);
+
+  /**
+   * @brief Despawns the next AppConfig::churnPerFrame crowd actors and spawns them again.
+   */
+  void
+    churnCrowd();
+
+  AppConfig          m_config;                           //Loop options.
+  FrameStats         m_frameStats;                       //Timings of the main loop.
+  ArchetypeStorage m_storage;                            //Archetype tables; declared first so it outlives the actors.
   EngineUtilities::TSharedPointer<Window> m_windowPtr;   //Pointer to custom Window class.
   EngineUtilities::TSharedPointer<CShape> m_shapePtr;    //Pointer to custom shape class.
-  EngineUtilities::TSharedPointer<Actor>  m_circleActor;
-  EngineUtilities::TSharedPointer<Actor>  m_trackActor;
+  EntityRegistry     m_registry;                         //Owns every actor; declared after m_storage.
+  EntityHandle       m_circleActor;
+  EntityHandle       m_trackActor;
 
 
 
+  JobSystem          m_jobSystem;                        //Worker threads; declared before the systems that use it.
+  EngineUtilities::FrameArena m_frameArena;              //Per-frame scratch memory; reset at the end of each loop iteration.
+  SystemScheduler    m_scheduler;                        //Per-frame systems (seek, transform sync, render).
+  RenderSystem*      m_renderSystem = nullptr;           //Owned by m_scheduler; read for draw call stats.
+  TransformSyncSystem* m_transformSync = nullptr;        //Owned by m_scheduler; receives the interpolation factor.
+  SpatialGridSystem* m_spatialGrid = nullptr;            //Owned by m_scheduler; answers neighbour queries.
+  CollisionSystem*   m_collisionSystem = nullptr;        //Owned by m_scheduler; contacts of the last tick.
+  float              m_accumulator = 0.f;                //Frame time not yet simulated, in seconds.
   ResourceManager    resourceMan;
-  std::vector<sf::Vector2f> m_waypoints; ///< Posiciones a seguir por el actor.
-  int m_currentWaypointIndex = 0;        ///< Indice del waypoint.
+  std::vector<std::pair<EntityHandle, TextureRequest>> m_pendingTextures; //Actors still showing the placeholder.
+  EngineUtilities::TSharedPointer<Path> m_trackPath;     //Path shared by Mario and the crowd.
+  std::vector<EntityHandle> m_crowd;                     //Crowd actors, by position along the path.
+  uint32_t           m_churnCursor = 0;                  //Next crowd actor to respawn.
+  TextureRequest     m_crowdTexture;                     //Texture shared by the crowd.
  
 };
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include "ECS/Component.h"
 #include <ECS/Texture.h>
 
+class Sprite;
+
   class Window;
 
 /**
@@ -67,8 +69,9 @@ public:
   /**
    * @brief Creates a new shape based on the specified type.
    * @param shapeType Type of shape to create.
+   * @return ErrorCode::OK, or ErrorCode::INVALID_ARGUMENT for an unknown type.
    */
-  void
+  ErrorCode
     createShape(ShapeType shapeType);
 
   /**
@@ -116,6 +119,13 @@ public:
   void 
     setTexture(const EngineUtilities::TSharedPointer<Texture>& texture);
 
+  /**
+   * @brief Shows a sprite: its texture page, its UV rect and its tint as fill color.
+   * @param sprite Sprite component of the same entity.
+   */
+  void
+    applySprite(const Sprite& sprite);
+
 private:
   EngineUtilities::TSharedPointer<sf::Shape> m_shapePtr; ///< Smart pointer to the SFML shape.
   ShapeType m_shapeType = ShapeType::EMPTY;              ///< Type of the current shape.
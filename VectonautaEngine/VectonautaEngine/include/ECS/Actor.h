@@ -22,8 +22,9 @@ public:
   /**
    * @brief Constructor que inicializa el Actor con un nombre.
    * @param actorName Nombre a asignar al actor.
+   * @param storage Almacenamiento por arquetipos donde vivira el actor (nullptr = modo independiente).
    */
-  Actor(const std::string& actorName);
+  Actor(const std::string& actorName, ArchetypeStorage* storage = nullptr);
 
   /**
    * @brief Destructor virtual por defecto del Actor.
@@ -58,34 +59,23 @@ public:
     destroy() override;
 
   /**
-   * @brief Obtiene un componente del tipo especificado si existe en el Actor.
-   * @tparam T Tipo del componente a buscar.
-   * @return Referencia compartida al componente del tipo T si se encuentra; nullptr en caso contrario.
+   * @brief Asigna la textura del actor a traves de su componente Sprite (lo crea si no existe).
+   * @param texture Textura compartida del ResourceManager.
    */
-  template <typename T>
-  EngineUtilities::TSharedPointer<T> getComponent();
-
   void
     setTexture(const EngineUtilities::TSharedPointer<Texture>& texture);
 
+  /**
+   * @brief Cambia el tinte del Sprite del actor y el color de relleno de su figura.
+   * @param tint Color que multiplica a la textura.
+   */
+  void
+    setTint(const sf::Color& tint);
+
 private:
   /**
    * @brief Nombre del actor.
    */
   std::string m_name = "Actor";
 
-};
-
-/**
- * @brief Implementacin de la plantilla getComponent.
- * @tparam T Tipo del componente a buscar.
- * @return Referencia compartida al componente del tipo T si se encuentra; nullptr en caso contrario.
- */
-template <typename T>
-inline EngineUtilities::TSharedPointer<T> Actor::getComponent() {
-  for (auto& component : components) {
-    auto specific = component.template dynamic_pointer_cast<T>();
-    if (specific) return specific;
-  }
-  return {};
-}
\ No newline at end of file
+};
\ No newline at end of file
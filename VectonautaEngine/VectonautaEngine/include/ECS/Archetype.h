@@ -0,0 +1,105 @@
+#pragma once
+
+/**
+ * @file Archetype.h
+ * @brief Declares the Archetype class, a table of entities that share the same component set.
+ */
+
+#include "../Prerequisites.h"
+#include "ComponentTypeID.h"
+#include "ECS/Transform.h"
+
+class
+  Entity;
+
+/**
+ * @class Archetype
+ * @brief Stores every entity with one exact component signature in structure-of-arrays form.
+ *
+ * Each row is one entity. Transform data is kept by value in contiguous arrays; every other
+ * component type gets a column of pointers. Rows are removed with swap-and-pop, so row indices
+ * are only stable until the next removal.
+ */
+class
+  Archetype {
+public:
+  /**
+   * @brief Creates an empty archetype for the given signature.
+   * @param signature Component types shared by all rows.
+   */
+  explicit Archetype(const ComponentSignature& signature);
+
+  /**
+   * @brief Destructor.
+   */
+  ~Archetype() = default;
+
+  /**
+   * @brief Appends an entity as a new row and binds its Transform to the arrays.
+   * @param entity Entity whose signature matches this archetype.
+   * @return Row assigned to the entity.
+   */
+  uint32_t
+    addEntity(Entity& entity);
+
+  /**
+   * @brief Removes a row, moving the last row into its place.
+   *
+   * The removed entity's Transform gets its values copied back before the row disappears.
+   * @param row Row to remove.
+   */
+  void
+    removeEntity(uint32_t row);
+
+  /**
+   * @brief Returns the number of rows.
+   */
+  uint32_t
+    size() const { return static_cast<uint32_t>(m_entities.size()); }
+
+  /**
+   * @brief Returns the component signature of this archetype.
+   */
+  const ComponentSignature&
+    getSignature() const { return m_signature; }
+
+  /**
+   * @brief Returns the entity stored in a row.
+   */
+  Entity*
+    getEntity(uint32_t row) const { return m_entities[row]; }
+
+  /**
+   * @brief Returns the contiguous Transform arrays (empty if the signature has no Transform).
+   */
+  TransformColumns&
+    getTransforms() { return m_transforms; }
+
+  /**
+   * @brief Returns the component of type T stored in a row.
+   * @tparam T Component type that is part of the signature.
+   */
+  template<typename T>
+  T*
+    getComponent(uint32_t row) const {
+    return static_cast<T*>(m_columns[ComponentTypeID::get<T>()][row]);
+  }
+
+  /**
+   * @brief Points a row's column at a new component of the same type.
+   * @param typeId Type ID that is part of the signature.
+   * @param row Row to update.
+   * @param component New component of the row.
+   */
+  void
+    setComponent(uint32_t typeId, uint32_t row, Component* component) {
+    m_columns[typeId][row] = component;
+  }
+
+private:
+  ComponentSignature m_signature;        ///< Component types shared by all rows.
+  bool m_hasTransform = false;           ///< Whether rows carry Transform data.
+  std::vector<Entity*> m_entities;       ///< Owning entity of each row.
+  TransformColumns m_transforms;         ///< Transform data of each row.
+  std::array<std::vector<Component*>, MAX_COMPONENT_TYPES> m_columns; ///< Component pointers per type ID.
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+/**
+ * @file ArchetypeStorage.h
+ * @brief Declares ArchetypeStorage, the owner of all archetype tables of a scene.
+ */
+
+#include "../Prerequisites.h"
+#include "ComponentTypeID.h"
+#include "Archetype.h"
+
+class
+  Entity;
+
+/**
+ * @class ArchetypeStorage
+ * @brief Groups entities by component signature into Archetype tables.
+ *
+ * Entities join through Entity::setStorage(). When an entity gains a new component type it is
+ * moved to the archetype matching its new signature. Systems use forEach() to stream over the
+ * rows of every archetype that contains a set of components.
+ */
+class
+  ArchetypeStorage {
+public:
+  /**
+   * @brief Default constructor.
+   */
+  ArchetypeStorage() = default;
+
+  /**
+   * @brief Destructor. Detaches every remaining entity so none keeps a dangling binding.
+   */
+  ~ArchetypeStorage();
+
+  ArchetypeStorage(const ArchetypeStorage&) = delete;
+  ArchetypeStorage& operator=(const ArchetypeStorage&) = delete;
+
+  /**
+   * @brief Adds an entity to the archetype matching its signature.
+   * @param entity Entity to add; must not already be stored.
+   */
+  void
+    attach(Entity& entity);
+
+  /**
+   * @brief Removes an entity from its archetype.
+   * @param entity Entity previously attached to this storage.
+   */
+  void
+    detach(Entity& entity);
+
+  /**
+   * @brief Moves an entity to the archetype of its current signature if it changed.
+   * @param entity Entity attached to this storage.
+   */
+  void
+    refresh(Entity& entity);
+
+  /**
+   * @brief Calls func for every non-empty archetype whose signature contains required.
+   * @param required Components the archetype must have.
+   * @param func Callable taking an Archetype&.
+   */
+  template<typename Func>
+  void
+    forEach(const ComponentSignature& required, Func&& func) {
+    for (auto& archetype : m_archetypes) {
+      if (archetype->size() > 0 &&
+          (archetype->getSignature() & required) == required) {
+        func(*archetype);
+      }
+    }
+  }
+
+  /**
+   * @brief Saves the Transform state of every archetype as its previous state.
+   *
+   * Call once at the start of each fixed simulation tick.
+   */
+  void
+    storePreviousTransforms();
+
+  /**
+   * @brief Returns the number of archetypes created so far.
+   */
+  size_t
+    getArchetypeCount() const { return m_archetypes.size(); }
+
+private:
+  /**
+   * @brief Returns the archetype for a signature, creating it on first use.
+   */
+  Archetype&
+    findOrCreate(const ComponentSignature& signature);
+
+  std::vector<EngineUtilities::TUniquePtr<Archetype>> m_archetypes;      ///< Archetypes in creation order.
+  std::unordered_map<ComponentSignature, size_t> m_archetypeLookup;       ///< Signature -> index in m_archetypes.
+};
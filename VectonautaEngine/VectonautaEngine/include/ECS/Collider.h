@@ -0,0 +1,134 @@
+#pragma once
+
+/**
+ * @file Collider.h
+ * @brief Declares the Collider component, the collision geometry consumed by CollisionSystem.
+ */
+
+#include "../Prerequisites.h"
+#include "ECS/Component.h"
+#include "CShape.h"
+
+class Window;
+
+/**
+ * @enum ColliderType
+ * @brief Geometry of a Collider.
+ */
+enum class
+  ColliderType {
+  NONE = 0,   ///< No geometry; ignored by CollisionSystem.
+  CIRCLE = 1, ///< Circle given by a center and a radius.
+  POLYGON = 2 ///< Convex polygon.
+};
+
+/**
+ * @class Collider
+ * @brief Collision geometry of an entity, in the local space of its shape.
+ *
+ * The geometry goes through the entity's Transform the same way the shape does (position,
+ * rotation, scale around the shape origin), so a collider built with setFromShape() matches
+ * what is drawn. Polygons must be convex.
+ */
+class
+  Collider : public Component {
+public:
+  /**
+   * @brief Default constructor. Creates an empty collider.
+   */
+  Collider() : Component(ComponentType::PHYSICS) {}
+
+  /**
+   * @brief Creates a collider that matches a shape.
+   * @param shape Shape whose geometry is copied.
+   */
+  explicit Collider(CShape& shape) : Component(ComponentType::PHYSICS) {
+    setFromShape(shape);
+  }
+
+  /**
+   * @brief Destructor.
+   */
+  virtual
+    ~Collider() = default;
+
+  void
+    start() override {}
+
+  void
+    update(float) override {}
+
+  void
+    render(const EngineUtilities::TSharedPointer<Window>&) override {}
+
+  void
+    destroy() override {}
+
+  /**
+   * @brief Copies the geometry of a shape: circles stay circles, everything else is a polygon.
+   * @param shape Shape to copy; must be created already.
+   */
+  void
+    setFromShape(CShape& shape) {
+    sf::Shape* sfShape = shape.getShape();
+    if (sfShape == nullptr) {
+      m_type = ColliderType::NONE;
+      m_points.clear();
+      return;
+    }
+    const sf::Vector2f origin = sfShape->getOrigin();
+    if (auto circle = dynamic_cast<sf::CircleShape*>(sfShape)) {
+      // sf::CircleShape se dibuja en [0, 2r] x [0, 2r]
+      const float radius = circle->getRadius();
+      setCircle(sf::Vector2f(radius, radius) - origin, radius);
+      return;
+    }
+    std::vector<sf::Vector2f> points(sfShape->getPointCount());
+    for (size_t i = 0; i < points.size(); ++i) {
+      points[i] = sfShape->getPoint(i) - origin;
+    }
+    setPolygon(points);
+  }
+
+  /**
+   * @brief Makes the collider a circle.
+   * @param center Center in local space.
+   * @param radius Radius in local units.
+   */
+  void
+    setCircle(const sf::Vector2f& center, float radius) {
+    m_type = ColliderType::CIRCLE;
+    m_center = center;
+    m_radius = radius;
+    m_points.clear();
+  }
+
+  /**
+   * @brief Makes the collider a convex polygon.
+   * @param points Vertices in local space, in order around the polygon (any winding).
+   */
+  void
+    setPolygon(const std::vector<sf::Vector2f>& points) {
+    m_type = points.size() >= 3 ? ColliderType::POLYGON : ColliderType::NONE;
+    m_points = points;
+  }
+
+  // Getters
+  ColliderType
+    getType() const { return m_type; }
+
+  const sf::Vector2f&
+    getCenter() const { return m_center; }
+
+  float
+    getRadius() const { return m_radius; }
+
+  const std::vector<sf::Vector2f>&
+    getPoints() const { return m_points; }
+
+private:
+  ColliderType m_type = ColliderType::NONE;    ///< Geometry kind.
+  sf::Vector2f m_center{ 0.f, 0.f };           ///< Circle center, local space.
+  float m_radius = 0.f;                        ///< Circle radius.
+  std::vector<sf::Vector2f> m_points;          ///< Polygon vertices, local space.
+};
@@ -18,12 +18,14 @@ enum
   ComponentType {
   None = 0,       ///< No component
   TRANSFORM = 1,   ///< Transform component (position, rotation, scale)
-  SRPITE = 2,     ///< Sprite component (2D image)
+  SRPITE = 2,     ///< Sprite component (texture reference, UV rect and tint)
   RENDERER = 3,   ///< Renderer component
-  PHYSICS = 4,    ///< Physics simulation component
+  PHYSICS = 4,    ///< Collision geometry component (Collider)
   AUDIOSOURCE = 5,///< Audio source component
   SHAPE = 6,      ///< Shape component (geometry-based)
-  TEXTURE = 7     ///< Texture component (for applying textures)
+  TEXTURE = 7,    ///< Reserved: textures are shared resources referenced by Sprite
+  STEERING = 8,   ///< Steering target component (seek behaviour)
+  PATH_FOLLOWER = 9 ///< Path following component (distance along a shared Path)
 };
 
 /**
@@ -88,5 +90,5 @@ public:
     getType() const { return m_type; }
 
 protected:
-  ComponentType m_type; ///< The specific type of the component.
+  ComponentType m_type = ComponentType::None; ///< The specific type of the component.
 };
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+/**
+ * @file ComponentTypeID.h
+ * @brief Declares the compile-time component type identifiers used to index entity components.
+ */
+
+#include "../Prerequisites.h"
+
+/**
+ * @brief Maximum number of distinct component types an entity can index.
+ */
+constexpr uint32_t MAX_COMPONENT_TYPES = 32;
+
+/**
+ * @class ComponentTypeID
+ * @brief Hands out a small, dense integer per component type.
+ *
+ * Every component type gets its ID the first time it is queried and keeps it for the rest of
+ * the program. Entities use the ID as a slot index, so typed lookups never need RTTI.
+ */
+class
+  ComponentTypeID {
+public:
+  /**
+   * @brief Returns the identifier assigned to the component type T.
+   * @tparam T Exact component type (base classes get their own ID).
+   * @return Dense identifier in the range [0, MAX_COMPONENT_TYPES).
+   */
+  template<typename T>
+  static uint32_t
+    get() {
+    static const uint32_t id = next();
+    return id;
+  }
+
+private:
+  /**
+   * @brief Reserves the next free identifier.
+   *
+   * Reports an error for every type past MAX_COMPONENT_TYPES: entities cannot index it, so
+   * getComponent() would never find it.
+   * @return A new identifier, unique for the whole program.
+   */
+  static uint32_t
+    next() {
+    static std::atomic<uint32_t> counter{ 0 };
+    const uint32_t id = counter.fetch_add(1, std::memory_order_relaxed);
+    if (id >= MAX_COMPONENT_TYPES) {
+      REPORT_ERROR(ErrorCode::INVALID_ARGUMENT, "ComponentTypeID", "next",
+                   "More component types than MAX_COMPONENT_TYPES; raise the limit");
+    }
+    return id;
+  }
+};
+
+/**
+ * @brief Bit set describing which component types an entity or archetype holds.
+ */
+using ComponentSignature = std::bitset<MAX_COMPONENT_TYPES>;
+
+/**
+ * @brief Builds the signature that contains exactly the given component types.
+ * @tparam Ts Component types to include.
+ */
+template<typename... Ts>
+ComponentSignature
+makeSignature() {
+  ComponentSignature signature;
+  (signature.set(ComponentTypeID::get<Ts>()), ...);
+  return signature;
+}
@@ -1,16 +1,32 @@
 #pragma once
 #include "..//Prerequisites.h"
 #include "Component.h"
+#include "ComponentTypeID.h"
+#include "EntityHandle.h"
 
 class
   Window;
+class
+  Archetype;
+class
+  ArchetypeStorage;
 
 class
   Entity {
 public:
 
+  /**
+   * @brief Default constructor. Leaves every component slot empty.
+   */
+  Entity() {
+    m_componentSlots.fill(-1);
+  }
+
+  /**
+   * @brief Destructor. Removes the entity from its archetype storage, if any.
+   */
   virtual
-    ~Entity() = default;
+    ~Entity();
 
   /**
    * @brief Pure virtual method for initialization logic.
@@ -40,30 +56,192 @@ public:
     destroy() = 0;
 
 
+  /**
+   * @brief Adds a component and registers it in the slot of its type.
+   *
+   * Only the first component of a given type is indexed; later ones are still
+   * owned by the entity (and drawn by Actor::render) but are not returned by
+   * getComponent(). Use setComponent() to swap the indexed one.
+   * @tparam T Exact type of the component.
+   * @param component Component to add.
+   */
   template<typename T> void
     addComponent(EngineUtilities::TSharedPointer<T> component) {
     static_assert(std::is_base_of<Component, T>
       ::value, "T must be derived from Component");
-    components.push_back
-    (component.template dynamic_pointer_cast<Component>());
+    const uint32_t typeId = ComponentTypeID::get<T>();
+    const bool newType = typeId < MAX_COMPONENT_TYPES && m_componentSlots[typeId] < 0;
+    if (newType) {
+      m_componentSlots[typeId] = static_cast<int16_t>(components.size());
+      m_signature.set(typeId);
+    }
+    components.push_back(EngineUtilities::TSharedPointer<Component>(component));
+    if (newType) {
+      onSignatureChanged();
+    }
   }
 
+  /**
+   * @brief Adds a component of type T, or replaces the one the entity already holds.
+   *
+   * Replacing keeps the entity in its archetype and row, so draw and update order do not change.
+   * @tparam T Component type, must derive from Component.
+   * @param component Shared pointer to the component.
+   */
+  template<typename T>
+  void
+    setComponent(EngineUtilities::TSharedPointer<T> component) {
+    const int16_t slot = findSlot<T>();
+    if (slot < 0) {
+      addComponent(component);
+      return;
+    }
+    components[slot] = EngineUtilities::TSharedPointer<Component>(component);
+    onComponentReplaced(ComponentTypeID::get<T>());
+  }
+
+  /**
+   * @brief Returns a shared reference to the component of type T, in O(1).
+   *
+   * The lookup is by exact type: a component added as a derived class is not found through
+   * its base class.
+   * @tparam T Exact type the component was added with.
+   * @return Shared pointer to the component, or a null pointer if the entity has none.
+   */
   template<typename T>
   EngineUtilities::TSharedPointer<T>
     getComponent() {
-    for (auto& component : components) {
-      EngineUtilities::TSharedPointer<T> specificComponent
-        = component.template dynamic_pointer_cast<T>();
-      if (specificComponent) {
-        return specificComponent;
-      }
+    const int16_t slot = findSlot<T>();
+    if (slot < 0) {
+      return EngineUtilities::TSharedPointer<T>();
     }
+    auto& component = components[slot];
+    return EngineUtilities::TSharedPointer<T>(static_cast<T*>(component.get()),
+                                              component.controlBlock);
+  }
 
-    return EngineUtilities::TSharedPointer<T>();
+  /**
+   * @brief Returns a raw pointer to the component of type T without touching its reference count.
+   *
+   * Meant for per-frame code; the pointer stays valid while the entity owns the component.
+   * @tparam T Exact type the component was added with.
+   * @return Pointer to the component, or nullptr if the entity has none.
+   */
+  template<typename T>
+  T*
+    getComponentPtr() const {
+    const int16_t slot = findSlot<T>();
+    return slot < 0 ? nullptr : static_cast<T*>(components[slot].get());
   }
 
+  /**
+   * @brief Checks whether the entity has a component of type T.
+   */
+  template<typename T>
+  bool
+    hasComponent() const {
+    return findSlot<T>() >= 0;
+  }
+
+  /**
+   * @brief Returns the indexed component with the given type ID.
+   * @param typeId Identifier obtained from ComponentTypeID.
+   * @return Pointer to the component, or nullptr if the entity has none.
+   */
+  Component*
+    getComponentById(uint32_t typeId) const {
+    if (typeId >= MAX_COMPONENT_TYPES || m_componentSlots[typeId] < 0) {
+      return nullptr;
+    }
+    return components[m_componentSlots[typeId]].get();
+  }
+
+  /**
+   * @brief Returns the handle given by the EntityRegistry (null if not registered).
+   */
+  EntityHandle
+    getHandle() const {
+    EntityHandle handle;
+    handle.value = id;
+    return handle;
+  }
+
+  /**
+   * @brief Checks whether the entity is registered and not destroyed.
+   */
+  bool
+    getIsActive() const { return isActive; }
+
+  /**
+   * @brief Returns the set of component types this entity holds.
+   */
+  const ComponentSignature&
+    getSignature() const { return m_signature; }
+
+  /**
+   * @brief Moves the entity into (or out of, with nullptr) an archetype storage.
+   *
+   * While stored, the Transform data lives in the storage's contiguous arrays.
+   * @param storage Storage to join, or nullptr to go back to standalone mode.
+   */
+  void
+    setStorage(ArchetypeStorage* storage);
+
+  /**
+   * @brief Returns the storage the entity lives in, or nullptr in standalone mode.
+   */
+  ArchetypeStorage*
+    getStorage() const { return m_storage; }
+
+  /**
+   * @brief Returns the archetype the entity lives in, or nullptr in standalone mode.
+   */
+  Archetype*
+    getArchetype() const { return m_archetype; }
+
+  /**
+   * @brief Returns the row of the entity inside its archetype.
+   */
+  uint32_t
+    getArchetypeRow() const { return m_archetypeRow; }
+
 protected:
-  bool isActive;
-  uint32_t id;
+  /**
+   * @brief Called when a component of a new type is added; moves the entity to its new archetype.
+   */
+  void
+    onSignatureChanged();
+
+  /**
+   * @brief Called when an indexed component is swapped for another of the same type.
+   * @param typeId Type ID of the replaced component.
+   */
+  void
+    onComponentReplaced(uint32_t typeId);
+
+  /**
+   * @brief Looks up the index of the component of type T inside components.
+   * @return Index into components, or -1 if not present.
+   */
+  template<typename T>
+  int16_t
+    findSlot() const {
+    const uint32_t typeId = ComponentTypeID::get<T>();
+    return typeId < MAX_COMPONENT_TYPES ? m_componentSlots[typeId] : int16_t(-1);
+  }
+
+  bool isActive = false;                 ///< True while registered in an EntityRegistry.
+  uint32_t id = EntityHandle::INVALID;   ///< Packed EntityHandle value.
   std::vector < EngineUtilities::TSharedPointer<Component>> components;
-};
\ No newline at end of file
+  std::array<int16_t, MAX_COMPONENT_TYPES> m_componentSlots; ///< Index into components per component type ID (-1 = none).
+  ComponentSignature m_signature;        ///< Component types held by the entity.
+
+private:
+  friend class Archetype;
+  friend class ArchetypeStorage;
+  friend class EntityRegistry;
+
+  ArchetypeStorage* m_storage = nullptr; ///< Storage the entity lives in (nullptr = standalone).
+  Archetype* m_archetype = nullptr;      ///< Archetype inside m_storage.
+  uint32_t m_archetypeRow = 0;           ///< Row inside m_archetype.
+};
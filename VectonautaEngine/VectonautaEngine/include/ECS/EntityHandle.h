@@ -0,0 +1,63 @@
+#pragma once
+
+/**
+ * @file EntityHandle.h
+ * @brief Declares EntityHandle, a 32-bit index + generation reference to a registered entity.
+ */
+
+#include "../Prerequisites.h"
+
+/**
+ * @struct EntityHandle
+ * @brief Weak, copyable reference to an entity in an EntityRegistry.
+ *
+ * The low bits index a registry slot and the high bits store the slot generation. A slot's
+ * generation changes every time it is freed, so a handle to a destroyed entity is detected
+ * in O(1) even after the slot has been reused.
+ */
+struct
+  EntityHandle {
+  static constexpr uint32_t INDEX_BITS = 20;                               ///< Up to ~1M live entities.
+  static constexpr uint32_t GENERATION_BITS = 32 - INDEX_BITS;             ///< Reuses before a generation repeats.
+  static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;         ///< Also the largest index; never handed out, so no handle packs to INVALID.
+  static constexpr uint32_t GENERATION_MASK = (1u << GENERATION_BITS) - 1;
+  static constexpr uint32_t INVALID = 0xFFFFFFFFu;                         ///< Value of a null handle.
+
+  uint32_t value = INVALID; ///< Packed generation and index.
+
+  /**
+   * @brief Default constructor. Creates a null handle.
+   */
+  EntityHandle() = default;
+
+  /**
+   * @brief Packs a slot index and generation into a handle.
+   */
+  EntityHandle(uint32_t index, uint32_t generation)
+    : value(((generation & GENERATION_MASK) << INDEX_BITS) | (index & INDEX_MASK)) {
+  }
+
+  /**
+   * @brief Returns the registry slot index.
+   */
+  uint32_t
+    getIndex() const { return value & INDEX_MASK; }
+
+  /**
+   * @brief Returns the slot generation the handle was created with.
+   */
+  uint32_t
+    getGeneration() const { return (value >> INDEX_BITS) & GENERATION_MASK; }
+
+  /**
+   * @brief Checks whether the handle is not null (it may still be stale).
+   */
+  bool
+    isValid() const { return value != INVALID; }
+
+  bool
+    operator==(const EntityHandle& other) const { return value == other.value; }
+
+  bool
+    operator!=(const EntityHandle& other) const { return value != other.value; }
+};
@@ -0,0 +1,141 @@
+#pragma once
+
+/**
+ * @file EntityRegistry.h
+ * @brief Declares EntityRegistry, which owns entities and hands out generational handles.
+ */
+
+#include "../Prerequisites.h"
+#include "EntityHandle.h"
+#include "Entity.h"
+
+/**
+ * @class EntityRegistry
+ * @brief Owns entities in a dense array and maps EntityHandle values to them.
+ *
+ * Live entities are packed in a dense array so iteration never skips holes. A sparse slot
+ * table maps handle indices to dense positions. Freed slots go to a FIFO free list, which
+ * spreads reuse across slots so generations wrap as late as possible. Creating and destroying
+ * entities reuses the capacity of all three arrays, so steady-state churn does not allocate
+ * inside the registry.
+ */
+class
+  EntityRegistry {
+public:
+  /**
+   * @brief Most entities alive at once. Index INDEX_MASK is never handed out (see EntityHandle).
+   */
+  static constexpr uint32_t CAPACITY = EntityHandle::INDEX_MASK;
+
+  /**
+   * @brief Default constructor.
+   */
+  EntityRegistry() = default;
+
+  /**
+   * @brief Destructor. Releases every registered entity.
+   */
+  ~EntityRegistry() = default;
+
+  EntityRegistry(const EntityRegistry&) = delete;
+  EntityRegistry& operator=(const EntityRegistry&) = delete;
+
+  /**
+   * @brief Creates an entity of type T in its object pool and registers it.
+   * @tparam T Entity type.
+   * @param args Arguments forwarded to the constructor of T.
+   * @return Handle of the new entity, or a null handle if the registry is full.
+   */
+  template<typename T, typename... Args>
+  EntityHandle
+    spawn(Args&&... args) {
+    static_assert(std::is_base_of<Entity, T>::value, "T must be derived from Entity");
+    return add(EngineUtilities::MakePooledShared<T>(std::forward<Args>(args)...));
+  }
+
+  /**
+   * @brief Registers an existing entity.
+   * @param entity Entity to take shared ownership of.
+   * @return Handle of the entity, or a null handle if the registry is full (reported as
+   *         RESOURCE_FAILURE).
+   */
+  EntityHandle
+    add(const EngineUtilities::TSharedPointer<Entity>& entity);
+
+  /**
+   * @brief Destroys an entity: calls Entity::destroy(), removes it from its storage and frees its slot.
+   * @param handle Handle of the entity.
+   * @return false if the handle was stale or null.
+   */
+  bool
+    destroy(EntityHandle handle);
+
+  /**
+   * @brief Checks in O(1) whether a handle still refers to a live entity.
+   */
+  bool
+    isAlive(EntityHandle handle) const {
+    if (!handle.isValid() || handle.getIndex() >= m_slots.size()) {
+      return false;
+    }
+    const Slot& slot = m_slots[handle.getIndex()];
+    return slot.generation == handle.getGeneration() && slot.denseIndex != FREE;
+  }
+
+  /**
+   * @brief Returns the entity of a handle, or nullptr if the handle is stale.
+   */
+  Entity*
+    get(EntityHandle handle) const {
+    return isAlive(handle) ? m_entities[m_slots[handle.getIndex()].denseIndex].get() : nullptr;
+  }
+
+  /**
+   * @brief Returns the entity of a handle as type T, or nullptr if the handle is stale.
+   * @tparam T Type the entity was spawned with (or one of its bases).
+   */
+  template<typename T>
+  T*
+    get(EntityHandle handle) const {
+    return static_cast<T*>(get(handle));
+  }
+
+  /**
+   * @brief Returns the number of live entities.
+   */
+  uint32_t
+    size() const { return static_cast<uint32_t>(m_entities.size()); }
+
+  /**
+   * @brief Returns the live entities, densely packed (order changes on destroy).
+   */
+  const std::vector<EngineUtilities::TSharedPointer<Entity>>&
+    getEntities() const { return m_entities; }
+
+  /**
+   * @brief Reserves room for a number of live entities.
+   */
+  void
+    reserve(uint32_t count);
+
+private:
+  static constexpr uint32_t FREE = 0xFFFFFFFFu; ///< denseIndex of a slot that is not in use.
+  static constexpr uint32_t NONE = 0xFFFFFFFFu; ///< End of the free list.
+
+  /**
+   * @struct Slot
+   * @brief Sparse entry addressed by a handle index.
+   */
+  struct
+    Slot {
+    uint32_t denseIndex = FREE; ///< Position in m_entities, or FREE.
+    uint32_t generation = 0;    ///< Bumped every time the slot is freed.
+    uint32_t nextFree = NONE;   ///< Next slot in the free list.
+  };
+
+  std::vector<Slot> m_slots;                                          ///< Sparse slot table.
+  std::vector<EngineUtilities::TSharedPointer<Entity>> m_entities;    ///< Dense live entities.
+  std::vector<uint32_t> m_denseToSlot;                                ///< Slot index of each dense entry.
+  uint32_t m_freeHead = NONE;                                         ///< Oldest freed slot.
+  uint32_t m_freeTail = NONE;                                         ///< Newest freed slot.
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+/**
+ * @file Path.h
+ * @brief Declares Path, an immutable spline that actors follow by distance.
+ */
+
+#include "../Prerequisites.h"
+
+/**
+ * @enum PathType
+ * @brief How the control points of a Path are joined.
+ */
+enum class
+  PathType {
+  LINEAR = 0,     ///< Straight segments between control points.
+  CATMULL_ROM = 1 ///< Smooth curve through every control point.
+};
+
+/**
+ * @class Path
+ * @brief Spline resampled at equal arc-length steps.
+ *
+ * A shared resource, not a component: it is built once and referenced by any number of
+ * PathFollower components. The constructor walks the curve and stores points spaced evenly by
+ * distance along it, so getPosition() is a table lookup plus one lerp, with no search and no
+ * square root. A Path never changes after construction, so systems can read it from any thread.
+ */
+class
+  Path {
+public:
+  /**
+   * @brief Builds the lookup table of a spline.
+   * @param points Control points; the curve passes through all of them.
+   * @param type How the points are joined.
+   * @param closed Whether the last point connects back to the first.
+   * @param spacing Distance between table entries, in pixels.
+   */
+  Path(const std::vector<sf::Vector2f>& points,
+       PathType type,
+       bool closed,
+       float spacing = 2.f);
+
+  /**
+   * @brief Destructor.
+   */
+  ~Path() = default;
+
+  /**
+   * @brief Returns the position at a distance along the path.
+   *
+   * Closed paths wrap the distance around; open paths clamp it to [0, getLength()].
+   * @param distance Distance from the first point, in pixels.
+   */
+  sf::Vector2f
+    getPosition(float distance) const;
+
+  /**
+   * @brief Brings a distance back into the range of the path (wraps or clamps).
+   */
+  float
+    wrapDistance(float distance) const;
+
+  /**
+   * @brief Returns the length of the path, in pixels.
+   */
+  float
+    getLength() const { return m_length; }
+
+  /**
+   * @brief Returns whether the path loops back to its start.
+   */
+  bool
+    isClosed() const { return m_closed; }
+
+  /**
+   * @brief Returns the number of entries in the lookup table.
+   */
+  size_t
+    getSampleCount() const { return m_samples.size(); }
+
+private:
+  std::vector<sf::Vector2f> m_samples; ///< Points spaced m_spacing apart along the curve.
+  float m_length = 0.f;                ///< Arc length of the whole path.
+  float m_invSpacing = 0.f;            ///< Table entries per pixel.
+  bool m_closed = false;               ///< Whether the path loops.
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+/**
+ * @file PathFollower.h
+ * @brief Declares the PathFollower component, the data consumed by PathFollowSystem.
+ */
+
+#include "../Prerequisites.h"
+#include "ECS/Component.h"
+#include "ECS/Path.h"
+
+class Window;
+
+/**
+ * @class PathFollower
+ * @brief Moves an entity along a shared Path at a constant speed.
+ *
+ * The only per-entity state is the distance travelled along the path; many followers can
+ * share one Path.
+ */
+class
+  PathFollower : public Component {
+public:
+  /**
+   * @brief Constructor.
+   * @param path Path to follow (shared, never modified).
+   * @param speed Speed in pixels per second.
+   * @param distance Starting distance along the path.
+   */
+  PathFollower(const EngineUtilities::TSharedPointer<Path>& path = EngineUtilities::TSharedPointer<Path>(),
+               float speed = 0.f,
+               float distance = 0.f)
+    : Component(ComponentType::PATH_FOLLOWER),
+    m_path(path),
+    m_speed(speed),
+    m_distance(distance) {
+  }
+
+  /**
+   * @brief Destructor.
+   */
+  virtual
+    ~PathFollower() = default;
+
+  void
+    start() override {}
+
+  void
+    update(float) override {}
+
+  void
+    render(const EngineUtilities::TSharedPointer<Window>&) override {}
+
+  void
+    destroy() override {}
+
+  /**
+   * @brief Moves the follower forward and returns its new position.
+   * @param deltaTime Time step in seconds.
+   */
+  sf::Vector2f
+    advance(float deltaTime) {
+    m_distance = m_path->wrapDistance(m_distance + m_speed * deltaTime);
+    return m_path->getPosition(m_distance);
+  }
+
+  // Setters
+  void
+    setPath(const EngineUtilities::TSharedPointer<Path>& path) { m_path = path; }
+
+  void
+    setSpeed(float speed) { m_speed = speed; }
+
+  void
+    setDistance(float distance) { m_distance = distance; }
+
+  // Getters
+  const EngineUtilities::TSharedPointer<Path>&
+    getPath() const { return m_path; }
+
+  float
+    getSpeed() const { return m_speed; }
+
+  float
+    getDistance() const { return m_distance; }
+
+private:
+  EngineUtilities::TSharedPointer<Path> m_path; ///< Shared path asset.
+  float m_speed;                                ///< Speed in pixels per second.
+  float m_distance;                             ///< Distance travelled along the path.
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+/**
+ * @file SeekTarget.h
+ * @brief Declares the SeekTarget component, the data consumed by SeekSystem.
+ */
+
+#include "../Prerequisites.h"
+#include "ECS/Component.h"
+
+class Window;
+
+/**
+ * @class SeekTarget
+ * @brief Tells SeekSystem where an entity should move and how fast.
+ */
+class
+  SeekTarget : public Component {
+public:
+  /**
+   * @brief Constructor.
+   * @param target Position to move toward.
+   * @param speed Speed in pixels per second.
+   * @param range Distance at which the entity is considered arrived.
+   */
+  SeekTarget(const sf::Vector2f& target = sf::Vector2f(0.f, 0.f),
+             float speed = 0.f,
+             float range = 0.f)
+    : Component(ComponentType::STEERING),
+    m_target(target),
+    m_speed(speed),
+    m_range(range) {
+  }
+
+  /**
+   * @brief Destructor.
+   */
+  virtual
+    ~SeekTarget() = default;
+
+  void
+    start() override {}
+
+  void
+    update(float) override {}
+
+  void
+    render(const EngineUtilities::TSharedPointer<Window>&) override {}
+
+  void
+    destroy() override {}
+
+  // Setters
+  void
+    setTarget(const sf::Vector2f& target) { m_target = target; }
+
+  void
+    setSpeed(float speed) { m_speed = speed; }
+
+  void
+    setRange(float range) { m_range = range; }
+
+  // Getters
+  const sf::Vector2f&
+    getTarget() const { return m_target; }
+
+  float
+    getSpeed() const { return m_speed; }
+
+  float
+    getRange() const { return m_range; }
+
+private:
+  sf::Vector2f m_target; ///< Position to move toward.
+  float m_speed;         ///< Speed in pixels per second.
+  float m_range;         ///< Arrival radius.
+};
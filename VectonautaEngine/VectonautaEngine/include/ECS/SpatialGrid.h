@@ -0,0 +1,258 @@
+#pragma once
+
+/**
+ * @file SpatialGrid.h
+ * @brief Declares SpatialGrid, a uniform-grid spatial hash of entity positions.
+ */
+
+#include "../Prerequisites.h"
+#include "EntityHandle.h"
+#include <cmath>
+
+class
+  JobSystem;
+
+/**
+ * @class SpatialGrid
+ * @brief Buckets entities by the grid cell that contains their position.
+ *
+ * The world is divided into square cells of a fixed size. Only cells that hold entities exist:
+ * they live in hash maps keyed by the packed cell coordinates. The maps are split into shards
+ * by key so a full rebuild can fill every shard on a different thread.
+ *
+ * Moving an entity inside its cell only writes its position. Crossing into another cell moves
+ * one index between two cell lists. Radius and AABB queries visit the cells that overlap the
+ * query area and test each entity in them, so their cost depends on local density, not on the
+ * total entity count.
+ *
+ * Not thread-safe for writes; concurrent queries are fine while nothing is being written.
+ */
+class
+  SpatialGrid {
+public:
+  /**
+   * @brief Constructor.
+   * @param cellSize Side of a cell in pixels. Close to the usual query radius works best.
+   */
+  explicit SpatialGrid(float cellSize = 64.f);
+
+  /**
+   * @brief Destructor.
+   */
+  ~SpatialGrid() = default;
+
+  /**
+   * @brief Adds an entity, or moves it if it is already in the grid.
+   * @param handle Entity to store.
+   * @param position Position of the entity.
+   */
+  void
+    insert(EntityHandle handle, const sf::Vector2f& position);
+
+  /**
+   * @brief Moves an entity already in the grid.
+   * @return false if the entity is not in the grid.
+   */
+  bool
+    update(EntityHandle handle, const sf::Vector2f& position);
+
+  /**
+   * @brief Removes an entity.
+   * @return false if the entity is not in the grid.
+   */
+  bool
+    remove(EntityHandle handle);
+
+  /**
+   * @brief Checks whether an entity is in the grid.
+   */
+  bool
+    contains(EntityHandle handle) const { return findEntry(handle) != NONE; }
+
+  /**
+   * @brief Removes every entity.
+   */
+  void
+    clear();
+
+  /**
+   * @brief Replaces the whole content of the grid.
+   *
+   * Faster than one insert() per entity when most of them changed cell. Cell coordinates are
+   * computed in parallel, entries are counting-sorted by shard, then each shard fills its own
+   * cells from its bucket on a separate job.
+   * @param handles Entities to store, each one at most once.
+   * @param positions Position of each entity.
+   * @param count Number of entities.
+   * @param jobSystem Workers for the rebuild (nullptr = serial).
+   */
+  void
+    rebuild(const EntityHandle* handles,
+            const sf::Vector2f* positions,
+            uint32_t count,
+            JobSystem* jobSystem = nullptr);
+
+  /**
+   * @brief Starts a sync pass: entities not inserted or updated before endSync() are dropped.
+   */
+  void
+    beginSync() { ++m_syncStamp; }
+
+  /**
+   * @brief Removes every entity that was not touched since beginSync().
+   * @return Number of entities removed.
+   */
+  uint32_t
+    endSync();
+
+  /**
+   * @brief Appends the entities within a distance of a point.
+   * @param center Center of the query circle.
+   * @param radius Radius of the query circle.
+   * @param out Receives the handles; not cleared first.
+   */
+  void
+    queryRadius(const sf::Vector2f& center, float radius, std::vector<EntityHandle>& out) const;
+
+  /**
+   * @brief Appends the entities whose position lies inside a rectangle.
+   * @param area Query rectangle (edges included).
+   * @param out Receives the handles; not cleared first.
+   */
+  void
+    queryAABB(const sf::FloatRect& area, std::vector<EntityHandle>& out) const;
+
+  /**
+   * @brief Returns the number of entities in the grid.
+   */
+  uint32_t
+    size() const { return static_cast<uint32_t>(m_entries.size()); }
+
+  /**
+   * @brief Returns the number of cells currently allocated (including empty ones).
+   */
+  size_t
+    getCellCount() const;
+
+  /**
+   * @brief Returns the side of a cell in pixels.
+   */
+  float
+    getCellSize() const { return m_cellSize; }
+
+private:
+  static constexpr uint32_t NONE = 0xFFFFFFFFu; ///< Missing entry index.
+  static constexpr uint32_t SHARD_BITS = 4;     ///< log2 of the number of shards.
+  static constexpr uint32_t SHARD_COUNT = 1u << SHARD_BITS;
+
+  /**
+   * @struct Entry
+   * @brief One stored entity.
+   */
+  struct
+    Entry {
+    EntityHandle handle;    ///< Entity of the entry.
+    sf::Vector2f position;  ///< Last known position.
+    uint64_t cell = 0;      ///< Packed coordinates of the containing cell.
+    uint32_t cellSlot = 0;  ///< Index inside the cell's list.
+    uint32_t shard = 0;     ///< Shard that owns the cell.
+    uint32_t stamp = 0;     ///< Sync pass that last touched the entry.
+  };
+
+  /**
+   * @struct CellHash
+   * @brief Mixes packed cell coordinates so neighbouring cells spread over buckets and shards.
+   */
+  struct
+    CellHash {
+    size_t
+      operator()(uint64_t key) const {
+      return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 16);
+    }
+  };
+
+  using CellMap = std::unordered_map<uint64_t, std::vector<uint32_t>, CellHash>;
+
+  /**
+   * @brief Returns the cell coordinate of a world coordinate.
+   */
+  int32_t
+    toCell(float value) const {
+    return static_cast<int32_t>(std::floor(value * m_invCellSize));
+  }
+
+  /**
+   * @brief Packs two cell coordinates into a key.
+   */
+  static uint64_t
+    packCell(int32_t x, int32_t y) {
+    return (uint64_t(uint32_t(x)) << 32) | uint64_t(uint32_t(y));
+  }
+
+  /**
+   * @brief Returns the shard that owns a cell.
+   */
+  static uint32_t
+    shardOf(uint64_t cell) {
+    return static_cast<uint32_t>((cell * 0x9E3779B97F4A7C15ull) >> (64 - SHARD_BITS));
+  }
+
+  /**
+   * @brief Returns the entry index of a handle, or NONE.
+   */
+  uint32_t
+    findEntry(EntityHandle handle) const;
+
+  /**
+   * @brief Returns the entity list of a cell, or nullptr if the cell does not exist.
+   */
+  const std::vector<uint32_t>*
+    findCell(uint64_t cell) const;
+
+  /**
+   * @brief Adds an entry to the list of its cell.
+   */
+  void
+    linkEntry(uint32_t index);
+
+  /**
+   * @brief Removes an entry from the list of its cell.
+   */
+  void
+    unlinkEntry(uint32_t index);
+
+  /**
+   * @brief Removes an entry, moving the last entry into its place.
+   */
+  void
+    eraseEntry(uint32_t index);
+
+  /**
+   * @brief Calls func(entryIndex) for every entry in the cells overlapping a rectangle.
+   */
+  template<typename Func>
+  void
+    forEachInCells(float left, float top, float right, float bottom, Func&& func) const {
+    const int32_t minX = toCell(left);
+    const int32_t maxX = toCell(right);
+    const int32_t minY = toCell(top);
+    const int32_t maxY = toCell(bottom);
+    for (int32_t x = minX; x <= maxX; ++x) {
+      for (int32_t y = minY; y <= maxY; ++y) {
+        if (const std::vector<uint32_t>* cell = findCell(packCell(x, y))) {
+          for (uint32_t index : *cell) {
+            func(index);
+          }
+        }
+      }
+    }
+  }
+
+  float m_cellSize;                          ///< Side of a cell.
+  float m_invCellSize;                       ///< 1 / m_cellSize.
+  uint32_t m_syncStamp = 0;                  ///< Current sync pass.
+  std::vector<Entry> m_entries;              ///< Dense stored entities.
+  std::vector<uint32_t> m_handleToEntry;     ///< Entry index per handle index, or NONE.
+  std::array<CellMap, SHARD_COUNT> m_shards; ///< Cell lists, split by shardOf().
+  std::vector<uint32_t> m_shardEntries;      ///< Scratch for rebuild(): entry indices grouped by shard.
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+/**
+ * @file Sprite.h
+ * @brief Declares the Sprite component, the per-entity reference to a shared Texture.
+ */
+
+#include "../Prerequisites.h"
+#include "ECS/Component.h"
+#include "ECS/Texture.h"
+
+class Window;
+
+/**
+ * @class Sprite
+ * @brief Material of an entity: which texture, which part of it, and which tint.
+ *
+ * The pixels live in the shared Texture owned by the ResourceManager; a sprite only holds a
+ * reference to it plus a UV rectangle and a color, so it stays small no matter how many
+ * entities use the same image.
+ */
+class
+  Sprite : public Component {
+public:
+  /**
+   * @brief Constructor.
+   * @param texture Shared texture; the UV rect starts as the whole texture area.
+   * @param tint Color multiplied with the texture.
+   */
+  explicit Sprite(const EngineUtilities::TSharedPointer<Texture>& texture =
+                    EngineUtilities::TSharedPointer<Texture>(),
+                  const sf::Color& tint = sf::Color::White)
+    : Component(ComponentType::SRPITE),
+    m_tint(tint) {
+    setTexture(texture);
+  }
+
+  /**
+   * @brief Destructor.
+   */
+  virtual
+    ~Sprite() = default;
+
+  void
+    start() override {}
+
+  void
+    update(float) override {}
+
+  void
+    render(const EngineUtilities::TSharedPointer<Window>&) override {}
+
+  void
+    destroy() override {}
+
+  // Setters
+  /**
+   * @brief Changes the texture and resets the UV rect to its whole area.
+   */
+  void
+    setTexture(const EngineUtilities::TSharedPointer<Texture>& texture) {
+    m_texture = texture;
+    m_uvRect = texture.isNull() ? sf::IntRect() : texture->getTextureRect();
+  }
+
+  void
+    setUVRect(const sf::IntRect& uvRect) { m_uvRect = uvRect; }
+
+  void
+    setTint(const sf::Color& tint) { m_tint = tint; }
+
+  // Getters
+  const EngineUtilities::TSharedPointer<Texture>&
+    getTexture() const { return m_texture; }
+
+  const sf::IntRect&
+    getUVRect() const { return m_uvRect; }
+
+  const sf::Color&
+    getTint() const { return m_tint; }
+
+private:
+  EngineUtilities::TSharedPointer<Texture> m_texture; ///< Shared texture resource.
+  sf::IntRect m_uvRect;                              ///< Area of the texture page to show, in pixels.
+  sf::Color m_tint;                                  ///< Color multiplied with the texture.
+};
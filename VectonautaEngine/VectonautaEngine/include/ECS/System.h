@@ -0,0 +1,88 @@
+#pragma once
+
+/**
+ * @file System.h
+ * @brief Declares the System base class run by SystemScheduler once per frame.
+ */
+
+#include "../Prerequisites.h"
+#include "ComponentTypeID.h"
+
+class
+  ArchetypeStorage;
+
+/**
+ * @enum SystemPhase
+ * @brief Part of the frame in which a system runs.
+ */
+enum class
+  SystemPhase {
+  UPDATE = 0, ///< Simulation, between event handling and rendering.
+  RENDER = 1  ///< Drawing, between Window::clear and Window::display.
+};
+
+/**
+ * @class System
+ * @brief Logic that runs once per frame over every entity with a given component set.
+ *
+ * A system declares which component types it reads and which it writes. The scheduler uses
+ * these sets to order systems and to find systems that can run together.
+ */
+class
+  System {
+public:
+  /**
+   * @brief Constructor.
+   * @param name Name used for debugging and profiling.
+   * @param phase Part of the frame in which the system runs.
+   * @param reads Component types the system only reads.
+   * @param writes Component types the system modifies.
+   */
+  System(const std::string& name,
+         SystemPhase phase,
+         const ComponentSignature& reads,
+         const ComponentSignature& writes)
+    : m_name(name), m_phase(phase), m_reads(reads), m_writes(writes) {
+  }
+
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual
+    ~System() = default;
+
+  /**
+   * @brief Runs the system over the storage.
+   * @param storage Archetype tables to iterate.
+   * @param deltaTime Time elapsed since last frame.
+   */
+  virtual void
+    run(ArchetypeStorage& storage, float deltaTime) = 0;
+
+  /**
+   * @brief Checks whether this system and another touch the same data with at least one writer.
+   */
+  bool
+    conflictsWith(const System& other) const {
+    return (m_writes & (other.m_reads | other.m_writes)).any() ||
+           (other.m_writes & m_reads).any();
+  }
+
+  const std::string&
+    getName() const { return m_name; }
+
+  SystemPhase
+    getPhase() const { return m_phase; }
+
+  const ComponentSignature&
+    getReads() const { return m_reads; }
+
+  const ComponentSignature&
+    getWrites() const { return m_writes; }
+
+protected:
+  std::string m_name;         ///< Debug name.
+  SystemPhase m_phase;        ///< Phase in which the system runs.
+  ComponentSignature m_reads; ///< Component types read.
+  ComponentSignature m_writes;///< Component types written.
+};
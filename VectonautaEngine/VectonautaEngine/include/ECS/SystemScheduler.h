@@ -0,0 +1,88 @@
+#pragma once
+
+/**
+ * @file SystemScheduler.h
+ * @brief Declares SystemScheduler, which orders systems into stages and runs them each frame.
+ */
+
+#include "../Prerequisites.h"
+#include "System.h"
+
+class
+  ArchetypeStorage;
+class
+  JobSystem;
+
+/**
+ * @class SystemScheduler
+ * @brief Owns the systems of an application and runs them phase by phase.
+ *
+ * Systems are grouped into stages. A system goes into the first stage after every earlier
+ * system it conflicts with, so registration order is kept for dependent systems. Systems that
+ * share a stage have no read/write conflict and may run together: with a job system set,
+ * the UPDATE phase runs each stage's systems as parallel jobs. The RENDER phase always runs on
+ * the calling thread, which owns the graphics context.
+ */
+class
+  SystemScheduler {
+public:
+  /**
+   * @brief Default constructor.
+   */
+  SystemScheduler() = default;
+
+  /**
+   * @brief Destructor.
+   */
+  ~SystemScheduler() = default;
+
+  /**
+   * @brief Creates a system and registers it.
+   * @tparam T System type.
+   * @param args Arguments forwarded to the constructor of T.
+   * @return Reference to the new system, owned by the scheduler.
+   */
+  template<typename T, typename... Args>
+  T&
+    addSystem(Args&&... args) {
+    static_assert(std::is_base_of<System, T>::value, "T must be derived from System");
+    T* system = new T(std::forward<Args>(args)...);
+    m_systems.push_back(EngineUtilities::TUniquePtr<System>(system));
+    m_dirty = true;
+    return *system;
+  }
+
+  /**
+   * @brief Sets the job system used to run independent systems together.
+   * @param jobSystem Job system, or nullptr to run every system on the calling thread.
+   */
+  void
+    setJobSystem(JobSystem* jobSystem) { m_jobSystem = jobSystem; }
+
+  /**
+   * @brief Runs every system of a phase, stage by stage.
+   * @param phase Phase to run.
+   * @param storage Archetype tables the systems iterate.
+   * @param deltaTime Time elapsed since last frame.
+   */
+  void
+    run(SystemPhase phase, ArchetypeStorage& storage, float deltaTime);
+
+  /**
+   * @brief Returns the stages of a phase, building them if systems were added.
+   */
+  const std::vector<std::vector<System*>>&
+    getStages(SystemPhase phase);
+
+private:
+  /**
+   * @brief Rebuilds the stage lists of every phase.
+   */
+  void
+    buildStages();
+
+  std::vector<EngineUtilities::TUniquePtr<System>> m_systems;   ///< Systems in registration order.
+  std::array<std::vector<std::vector<System*>>, 2> m_stages;     ///< Stages per phase.
+  bool m_dirty = false;                                          ///< Stages need rebuilding.
+  JobSystem* m_jobSystem = nullptr;                              ///< Runs independent systems together.
+};
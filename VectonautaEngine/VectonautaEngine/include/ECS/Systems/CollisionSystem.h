@@ -0,0 +1,190 @@
+#pragma once
+
+/**
+ * @file CollisionSystem.h
+ * @brief Declares CollisionSystem, which finds every overlapping pair of Collider entities.
+ */
+
+#include "ECS/System.h"
+#include "ECS/EntityHandle.h"
+#include "ECS/Collider.h"
+#include <algorithm>
+
+class
+  JobSystem;
+
+/**
+ * @struct ContactManifold
+ * @brief Overlap between two colliders.
+ */
+struct
+  ContactManifold {
+  EntityHandle a;                 ///< First entity.
+  EntityHandle b;                 ///< Second entity.
+  sf::Vector2f normal{ 0.f, 0.f };///< Unit direction from a to b; moving b by normal * depth separates them.
+  float depth = 0.f;              ///< Penetration depth along normal.
+  uint32_t pointCount = 0;        ///< Number of valid entries in points (1 or 2).
+  sf::Vector2f points[2];         ///< Contact points in world space.
+};
+
+/**
+ * @class CollisionSystem
+ * @brief Broad-phase sweep-and-prune plus SAT/circle narrow-phase over every Collider.
+ *
+ * Reads Transform and Collider. Each run:
+ *  1. transforms every collider to world space and computes its AABB, in parallel;
+ *  2. sorts the bodies by AABB left edge. The order is kept between runs and fixed with an
+ *     insertion sort, which is close to linear while bodies move a little per tick;
+ *  3. drops the sorted bodies into horizontal bands a few body heights tall (a body that
+ *     straddles a border goes into both), so each band stays sorted and only holds nearby
+ *     bodies. A one-axis sweep over a crowded world would test every body against everything
+ *     in the same column;
+ *  4. sweeps the bands in parallel. Pairs whose AABBs overlap go straight to the narrow phase
+ *     (circle/circle, circle/polygon, and SAT with edge clipping for polygons). A pair is only
+ *     tested in the band where its overlap starts, so it is reported once.
+ *
+ * The contacts of a run are available from getContacts() until the next run, in a fixed order.
+ * Circles under non-uniform scale use the larger scale factor.
+ */
+class
+  CollisionSystem : public System {
+public:
+  /**
+   * @brief Constructor.
+   * @param jobSystem Job system used for the parallel passes (nullptr = serial).
+   */
+  explicit CollisionSystem(JobSystem* jobSystem = nullptr);
+
+  void
+    run(ArchetypeStorage& storage, float deltaTime) override;
+
+  /**
+   * @brief Returns the contacts found by the last run.
+   */
+  const std::vector<ContactManifold>&
+    getContacts() const { return m_contacts; }
+
+  /**
+   * @brief Returns the number of colliders processed by the last run.
+   */
+  uint32_t
+    getBodyCount() const { return static_cast<uint32_t>(m_bodies.size()); }
+
+  /**
+   * @brief Returns the number of pairs that passed the broad phase in the last run.
+   */
+  uint64_t
+    getPairCount() const { return m_pairCount; }
+
+private:
+  /**
+   * @struct Body
+   * @brief One collider in world space.
+   */
+  struct
+    Body {
+    EntityHandle handle;                      ///< Owning entity.
+    ColliderType type = ColliderType::NONE;   ///< Geometry kind.
+    const Collider* collider = nullptr;       ///< Local geometry.
+    sf::Vector2f position;                    ///< Transform position.
+    float rotation = 0.f;                     ///< Transform rotation in degrees.
+    sf::Vector2f scale;                       ///< Transform scale.
+    sf::Vector2f center;                      ///< World circle center.
+    float radius = 0.f;                       ///< World circle radius.
+    uint32_t firstVertex = 0;                 ///< First polygon vertex in m_vertices.
+    uint32_t vertexCount = 0;                 ///< Polygon vertex count.
+    float minX = 0.f, minY = 0.f;             ///< World AABB.
+    float maxX = 0.f, maxY = 0.f;
+  };
+
+  /**
+   * @struct SweepBox
+   * @brief AABB of a body copied into its bands so the sweep reads memory linearly.
+   */
+  struct
+    SweepBox {
+    float minX, maxX, minY, maxY;
+    uint32_t body; ///< Index in m_bodies.
+  };
+
+  /**
+   * @brief Collects colliders and transforms them to world space.
+   */
+  void
+    gatherBodies(ArchetypeStorage& storage);
+
+  /**
+   * @brief Sorts m_order by AABB left edge.
+   */
+  void
+    sortBodies();
+
+  /**
+   * @brief Splits the sorted bodies into horizontal bands.
+   */
+  void
+    fillBands();
+
+  /**
+   * @brief Returns the band that contains a height.
+   */
+  uint32_t
+    bandOf(float y) const {
+    const float band = (y - m_bandTop) * m_invBandHeight;
+    return band <= 0.f ? 0u : std::min(m_bandCount - 1, static_cast<uint32_t>(band));
+  }
+
+  /**
+   * @brief Sweeps every band and runs the narrow phase on overlapping pairs.
+   */
+  void
+    findContacts();
+
+  /**
+   * @brief Computes world geometry and the AABB of one body.
+   */
+  void
+    computeWorldGeometry(Body& body);
+
+  /**
+   * @brief Narrow phase for one pair.
+   * @return true if the bodies overlap; manifold is filled in that case.
+   */
+  bool
+    collide(const Body& a, const Body& b, ContactManifold& manifold) const;
+
+  bool
+    collideCircles(const Body& a, const Body& b, ContactManifold& manifold) const;
+
+  /**
+   * @brief Polygon against circle; the normal goes from the polygon to the circle.
+   */
+  bool
+    collidePolygonCircle(const Body& polygon, const Body& circle, ContactManifold& manifold) const;
+
+  bool
+    collidePolygons(const Body& a, const Body& b, ContactManifold& manifold) const;
+
+  /**
+   * @brief Largest separation of b's vertices along a's edge normals.
+   * @param edge Receives the edge of a with that separation.
+   */
+  float
+    findMaxSeparation(const Body& a, const Body& b, uint32_t& edge) const;
+
+  JobSystem* m_jobSystem;                                    ///< Workers, or nullptr.
+  std::vector<Body> m_bodies;                                ///< Colliders of this run.
+  std::vector<sf::Vector2f> m_vertices;                      ///< World polygon vertices.
+  std::vector<sf::Vector2f> m_normals;                       ///< Outward edge normals, one per vertex.
+  std::vector<uint32_t> m_order;                             ///< Body indices sorted by minX.
+  std::vector<SweepBox> m_sweep;                             ///< AABBs grouped by band, sorted by minX inside each.
+  std::vector<uint32_t> m_bandStart;                         ///< First m_sweep entry of each band, plus an end marker.
+  std::vector<uint32_t> m_bandCursor;                        ///< Scratch: next free m_sweep entry per band.
+  uint32_t m_bandCount = 1;                                  ///< Number of bands this run.
+  float m_bandTop = 0.f;                                     ///< Top edge of band 0.
+  float m_invBandHeight = 0.f;                               ///< 1 / band height.
+  std::vector<std::vector<ContactManifold>> m_chunkContacts; ///< Contacts of each sweep chunk.
+  std::vector<uint64_t> m_chunkPairs;                        ///< Broad-phase pairs of each chunk.
+  std::vector<ContactManifold> m_contacts;                   ///< Contacts of the last run.
+  uint64_t m_pairCount = 0;                                  ///< Broad-phase pairs of the last run.
+};
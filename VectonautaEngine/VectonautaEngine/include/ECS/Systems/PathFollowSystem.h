@@ -0,0 +1,33 @@
+#pragma once
+
+/**
+ * @file PathFollowSystem.h
+ * @brief Declares PathFollowSystem, which moves entities along their PathFollower path.
+ */
+
+#include "ECS/System.h"
+
+class
+  JobSystem;
+
+/**
+ * @class PathFollowSystem
+ * @brief Advances every entity with a Transform and a PathFollower along its path.
+ *
+ * Writes PathFollower (distance travelled) and Transform (position).
+ */
+class
+  PathFollowSystem : public System {
+public:
+  /**
+   * @brief Constructor.
+   * @param jobSystem Job system used to split each archetype across threads (nullptr = serial).
+   */
+  explicit PathFollowSystem(JobSystem* jobSystem = nullptr);
+
+  void
+    run(ArchetypeStorage& storage, float deltaTime) override;
+
+private:
+  JobSystem* m_jobSystem; ///< Workers for the parallel pass, or nullptr.
+};
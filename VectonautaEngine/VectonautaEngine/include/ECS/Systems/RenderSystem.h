@@ -0,0 +1,57 @@
+#pragma once
+
+/**
+ * @file RenderSystem.h
+ * @brief Declares RenderSystem, which draws every CShape in the storage.
+ */
+
+#include "ECS/System.h"
+#include "Render/SpriteBatch.h"
+
+class
+  Window;
+
+/**
+ * @class RenderSystem
+ * @brief Draws the CShape of every stored entity to a window.
+ *
+ * Runs in SystemPhase::RENDER. Reads CShape. Shapes are drawn in entity index order (the
+ * order the EntityRegistry spawned them, like the old actor list), whatever archetype they
+ * live in. They go through a SpriteBatch, so consecutive shapes that share a texture cost one
+ * draw call instead of one each.
+ */
+class
+  RenderSystem : public System {
+public:
+  /**
+   * @brief Constructor.
+   * @param window Window to draw into.
+   * @param frameArena Arena for the batch's per-frame vertex arrays and the draw list.
+   */
+  RenderSystem(const EngineUtilities::TSharedPointer<Window>& window,
+               EngineUtilities::FrameArena& frameArena);
+
+  void
+    run(ArchetypeStorage& storage, float deltaTime) override;
+
+  /**
+   * @brief Returns the batch used last frame (draw call and shape counts).
+   */
+  const SpriteBatch&
+    getBatch() const { return m_batch; }
+
+private:
+  /**
+   * @brief One shape to draw and the key it is sorted by.
+   */
+  struct
+    DrawItem {
+    uint32_t entityIndex; ///< Index of the owning entity's handle.
+    sf::Shape* shape;     ///< Shape to submit.
+  };
+
+  EngineUtilities::TSharedPointer<Window> m_window; ///< Target window.
+  EngineUtilities::FrameArena& m_frameArena;        ///< Backs the per-frame draw list.
+  SpriteBatch m_batch;                              ///< Vertex arrays live in the frame arena.
+  size_t m_drawReserve = 0;                         ///< Most shapes drawn in one frame so far.
+};
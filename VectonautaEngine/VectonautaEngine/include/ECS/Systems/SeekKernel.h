@@ -0,0 +1,89 @@
+#pragma once
+
+/**
+ * @file SeekKernel.h
+ * @brief Declares the batched seek steering kernels (scalar, SSE and AVX).
+ */
+
+#include "../../Prerequisites.h"
+
+/**
+ * @class SeekKernel
+ * @brief Moves many positions toward their targets in one call, 1, 4 or 8 agents at a time.
+ *
+ * All paths compute exactly what Transform::seekStep does, with the same operations in the
+ * same order (sqrt, divide, multiply by speed, multiply by delta time, add), so they give
+ * bit-identical results. select() picks a path at run time among those the CPU supports:
+ * wide divide/sqrt units are slower than expected on some CPUs, so when AVX is available it
+ * is timed once against SSE and the faster one is kept.
+ */
+class
+  SeekKernel {
+public:
+  /**
+   * @brief Signature shared by every kernel path.
+   * @param positions Positions to update in place.
+   * @param targets Target of each position.
+   * @param speeds Speed of each agent, in pixels per second.
+   * @param ranges Arrival radius of each agent.
+   * @param count Number of agents.
+   * @param deltaTime Time step in seconds.
+   */
+  using Function = void(*)(sf::Vector2f* positions,
+                           const sf::Vector2f* targets,
+                           const float* speeds,
+                           const float* ranges,
+                           uint32_t count,
+                           float deltaTime);
+
+  /**
+   * @brief Instruction sets a kernel path can use.
+   */
+  enum class
+    Path {
+    SCALAR = 0, ///< One agent per step; works everywhere.
+    SSE = 1,    ///< Four agents per step (SSE2).
+    AVX = 2     ///< Eight agents per step (AVX).
+  };
+
+  /**
+   * @brief Returns the widest path supported by the CPU and the OS.
+   */
+  static Path
+    detect();
+
+  /**
+   * @brief Returns the fastest supported path, measured once on a synthetic batch and cached.
+   */
+  static Path
+    choose();
+
+  /**
+   * @brief Returns the kernel for a path (falls back to scalar if it was not compiled in).
+   */
+  static Function
+    get(Path path);
+
+  /**
+   * @brief Returns the kernel for the chosen path.
+   */
+  static Function
+    select() { return get(choose()); }
+
+  /**
+   * @brief Returns a readable name for a path.
+   */
+  static const char*
+    getName(Path path);
+
+  /**
+   * @brief Reference path: Transform::seekStep on each agent.
+   */
+  static void
+    seekScalar(sf::Vector2f* positions,
+               const sf::Vector2f* targets,
+               const float* speeds,
+               const float* ranges,
+               uint32_t count,
+               float deltaTime);
+};
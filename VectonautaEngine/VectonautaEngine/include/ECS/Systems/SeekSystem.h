@@ -0,0 +1,37 @@
+#pragma once
+
+/**
+ * @file SeekSystem.h
+ * @brief Declares SeekSystem, which moves entities toward their SeekTarget.
+ */
+
+#include "ECS/System.h"
+#include "ECS/Systems/SeekKernel.h"
+
+class
+  JobSystem;
+
+/**
+ * @class SeekSystem
+ * @brief Applies seek steering to every entity with a Transform and a SeekTarget.
+ *
+ * Reads SeekTarget, writes Transform. Each chunk of rows gathers its targets, speeds and
+ * ranges into contiguous arrays and runs the SeekKernel chosen for the CPU. The kernel is
+ * chosen on the first run that finds rows, so a scene without seekers never times kernels.
+ */
+class
+  SeekSystem : public System {
+public:
+  /**
+   * @brief Constructor.
+   * @param jobSystem Job system used to split each archetype across threads (nullptr = serial).
+   */
+  explicit SeekSystem(JobSystem* jobSystem = nullptr);
+
+  void
+    run(ArchetypeStorage& storage, float deltaTime) override;
+
+private:
+  JobSystem* m_jobSystem;       ///< Workers for the parallel pass, or nullptr.
+  SeekKernel::Function m_kernel; ///< Kernel selected for the current CPU, or nullptr until needed.
+};
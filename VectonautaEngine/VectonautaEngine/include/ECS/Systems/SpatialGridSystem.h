@@ -0,0 +1,66 @@
+#pragma once
+
+/**
+ * @file SpatialGridSystem.h
+ * @brief Declares SpatialGridSystem, which keeps a SpatialGrid in sync with Transform positions.
+ */
+
+#include "ECS/System.h"
+#include "ECS/SpatialGrid.h"
+
+class
+  JobSystem;
+
+/**
+ * @struct SpatialGridStats
+ * @brief How often and how long SpatialGridSystem rebuilt or synced its grid.
+ */
+struct
+  SpatialGridStats {
+  uint64_t rebuilds = 0;       ///< Runs that rebuilt the grid from scratch.
+  double rebuildSeconds = 0.0; ///< Time spent in those rebuilds.
+  uint64_t syncs = 0;          ///< Runs that updated the grid in place.
+  double syncSeconds = 0.0;    ///< Time spent in those syncs.
+};
+
+/**
+ * @class SpatialGridSystem
+ * @brief Mirrors the position of every registered entity with a Transform into a SpatialGrid.
+ *
+ * Reads Transform. Register it after the systems that move entities so queries see this
+ * tick's positions. Usually entities are updated in place, and only those that changed cell
+ * touch the cell maps. When the entity count changes a lot, or on the first run, the grid is
+ * rebuilt in parallel instead.
+ */
+class
+  SpatialGridSystem : public System {
+public:
+  /**
+   * @brief Constructor.
+   * @param jobSystem Job system used for full rebuilds (nullptr = serial).
+   * @param cellSize Side of a grid cell in pixels.
+   */
+  explicit SpatialGridSystem(JobSystem* jobSystem = nullptr, float cellSize = 64.f);
+
+  void
+    run(ArchetypeStorage& storage, float deltaTime) override;
+
+  /**
+   * @brief Returns the grid, up to date after this system has run.
+   */
+  const SpatialGrid&
+    getGrid() const { return m_grid; }
+
+  /**
+   * @brief Returns the rebuild and sync counters since construction.
+   */
+  const SpatialGridStats&
+    getStats() const { return m_stats; }
+
+private:
+  JobSystem* m_jobSystem;                ///< Workers for rebuilds, or nullptr.
+  SpatialGrid m_grid;                    ///< Entity positions by cell.
+  std::vector<EntityHandle> m_handles;   ///< Scratch: entities gathered this run.
+  std::vector<sf::Vector2f> m_positions; ///< Scratch: their positions.
+  SpatialGridStats m_stats;              ///< Rebuild and sync timings.
+};
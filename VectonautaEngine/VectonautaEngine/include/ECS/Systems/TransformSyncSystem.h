@@ -0,0 +1,42 @@
+#pragma once
+
+/**
+ * @file TransformSyncSystem.h
+ * @brief Declares TransformSyncSystem, which copies Transform data into CShape.
+ */
+
+#include "ECS/System.h"
+
+class
+  JobSystem;
+
+/**
+ * @class TransformSyncSystem
+ * @brief Copies position, rotation and scale of every Transform into the entity's CShape.
+ *
+ * Batched replacement for the per-actor copy done in Actor::update. Reads Transform, writes CShape.
+ * Runs in SystemPhase::RENDER, once per drawn frame, and blends the previous and current tick
+ * state by the interpolation factor set with setAlpha().
+ */
+class
+  TransformSyncSystem : public System {
+public:
+  /**
+   * @brief Constructor.
+   * @param jobSystem Job system used to split each archetype across threads (nullptr = serial).
+   */
+  explicit TransformSyncSystem(JobSystem* jobSystem = nullptr);
+
+  void
+    run(ArchetypeStorage& storage, float deltaTime) override;
+
+  /**
+   * @brief Sets how far the frame is between the previous tick (0) and the current one (1).
+   */
+  void
+    setAlpha(float alpha) { m_alpha = alpha; }
+
+private:
+  JobSystem* m_jobSystem; ///< Workers for the parallel pass, or nullptr.
+  float m_alpha = 1.f;    ///< Interpolation factor between previous and current state.
+};
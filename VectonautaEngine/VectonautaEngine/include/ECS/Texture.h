@@ -1,45 +1,81 @@
 #pragma once
 
-#include "Prerequisites.h"
-#include <ECS/Component.h>
-#include "Window.h"
-#include <string>
-#include <iostream>
+/**
+ * @file Texture.h
+ * @brief Declares Texture, a GPU texture resource shared by every sprite that uses it.
+ */
 
-class Window;  
+#include "Prerequisites.h"
+#include "Render/TextureAtlas.h"
 
-class Texture : public Component {
+/**
+ * @class Texture
+ * @brief Area of a GPU texture that holds one image.
+ *
+ * A plain resource, not a component: it is created and owned by the ResourceManager and
+ * referenced by Sprite components. Atlas textures share their page with other images; a
+ * standalone texture gets a page of its own. Either way a Texture is just a page reference and
+ * a rectangle, so keeping many of them alive is cheap.
+ */
+class
+  Texture {
 public:
-  Texture(const std::string& textureName,
-    const std::string& extension = "png")
-    : Component(ComponentType::TEXTURE),
-    m_textureName(textureName),
-    m_extension(extension)
-  {
-    std::string path = m_textureName + "." + m_extension;
-    if (!m_texture.loadFromFile(path)) {
-      std::cerr << "Error al cargar textura: " << path << std::endl;
+  /**
+   * @brief Uploads an image into a page of its own.
+   * @param image Decoded image.
+   */
+  explicit Texture(const sf::Image& image)
+    : m_page(EngineUtilities::MakeShared<AtlasPage>()) {
+    if (!m_page->texture.loadFromImage(image)) {
+      std::cerr << "Error al subir textura de " << image.getSize().x << "x"
+        << image.getSize().y << std::endl;
     }
-    m_sprite.setTexture(m_texture);
+    m_rect = sf::IntRect(0, 0, static_cast<int>(image.getSize().x),
+                         static_cast<int>(image.getSize().y));
+  }
+
+  /**
+   * @brief References a sub-rectangle of an atlas page.
+   * @param page Page that holds the pixels; kept alive by this texture.
+   * @param rect Area of the page, in pixels.
+   */
+  Texture(const EngineUtilities::TSharedPointer<AtlasPage>& page, const sf::IntRect& rect)
+    : m_page(page),
+    m_rect(rect) {
   }
 
-  ~Texture() override = default;
+  /**
+   * @brief Destructor.
+   */
+  ~Texture() = default;
 
-  void start()   override {}    // nada que hacer
-  void update(float) override {} // nada que hacer
+  /**
+   * @brief Returns the GPU texture that holds the pixels (the whole page).
+   */
+  sf::Texture&
+    getTexture() { return m_page->texture; }
 
-  // si prefieres inline:
-  void render(const EngineUtilities::TSharedPointer<Window>& window) override {
-    window->draw(m_sprite);
-  }
+  /**
+   * @brief Returns the page that holds the pixels (shared with the other images on it).
+   */
+  const EngineUtilities::TSharedPointer<AtlasPage>&
+    getPage() const { return m_page; }
 
-  void destroy() override {}    // SFML limpia sola
+  /**
+   * @brief Returns the area of getTexture() covered by this image.
+   */
+  const sf::IntRect&
+    getTextureRect() const { return m_rect; }
 
-  sf::Texture& getTexture() { return m_texture; }
+  /**
+   * @brief Returns the image size in pixels (not the page size).
+   */
+  sf::Vector2u
+    getSize() const {
+    return sf::Vector2u(static_cast<unsigned>(m_rect.width), static_cast<unsigned>(m_rect.height));
+  }
 
 private:
-  sf::Texture   m_texture;
-  sf::Sprite    m_sprite;
-  std::string   m_textureName;
-  std::string   m_extension;
+  EngineUtilities::TSharedPointer<AtlasPage> m_page; ///< Page holding the pixels.
+  sf::IntRect m_rect;                                ///< Image area inside the page.
 };
@@ -9,9 +9,43 @@
  */
 
 class Window;
+
+/**
+ * @struct TransformColumns
+ * @brief Contiguous position/rotation/scale arrays shared by every Transform of one archetype.
+ *
+ * Index i of each array belongs to the same entity, so systems can stream through them linearly.
+ * The previous* arrays keep the state at the start of the current simulation tick so rendering
+ * can interpolate between two ticks.
+ */
+struct
+  TransformColumns {
+  std::vector<sf::Vector2f> positions;         ///< Positions, one per row.
+  std::vector<sf::Vector2f> rotations;         ///< Rotations, one per row.
+  std::vector<sf::Vector2f> scales;            ///< Scales, one per row.
+  std::vector<sf::Vector2f> previousPositions; ///< Positions before the last tick.
+  std::vector<sf::Vector2f> previousRotations; ///< Rotations before the last tick.
+  std::vector<sf::Vector2f> previousScales;    ///< Scales before the last tick.
+
+  /**
+   * @brief Copies the current state into the previous-state arrays; called before each tick.
+   */
+  void
+    storePrevious() {
+    previousPositions = positions;
+    previousRotations = rotations;
+    previousScales = scales;
+  }
+};
+
 /**
  * @class Transform
  * @brief Component that holds position, rotation, and scale for an entity.
+ *
+ * While the owning entity lives in an ArchetypeStorage the data is kept in the archetype's
+ * TransformColumns and this object only forwards to its row; otherwise it uses its own fields.
+ * The setters teleport: they also overwrite the previous tick state, so a placed entity is not
+ * interpolated from its old position. Systems that move entities write the arrays directly.
  */
 
 class Transform : public Component {
@@ -55,43 +89,98 @@ public:
       float speed,
       float deltaTime,
       float range) {
-    sf::Vector2f direction = targetPosition - m_position;
+    seekStep(positionRef(), targetPosition, speed, deltaTime, range);
+  }
+
+  /**
+   * @brief Moves a position toward a target at constant speed, stopping inside range.
+   *
+   * Shared by Transform::seek and the batched SeekSystem so both give the same result.
+   */
+  static void
+    seekStep(sf::Vector2f& position,
+      const sf::Vector2f& targetPosition,
+      float speed,
+      float deltaTime,
+      float range) {
+    sf::Vector2f direction = targetPosition - position;
     float lenght = std::sqrt(direction.x * direction.x + direction.y * direction.y);
 
     if (lenght > range) {
       direction /= lenght;
-      m_position += direction * speed * deltaTime;
+      position += direction * speed * deltaTime;
     }
   }
 
   // Setters
   void
     setPosition(const sf::Vector2f& _position) {
-    m_position = _position;
+    positionRef() = _position;
+    if (m_columns) { m_columns->previousPositions[m_row] = _position; }
   }   //Actualiza el valor de la clase 
 
   void
     setRotation(const sf::Vector2f& _rotation) {
-    m_rotation = _rotation;
+    if (m_columns) {
+      m_columns->rotations[m_row] = _rotation;
+      m_columns->previousRotations[m_row] = _rotation;
+    }
+    else { m_rotation = _rotation; }
   }
 
   void
     setScale(const sf::Vector2f& _scale) {
-    m_scale = _scale;
+    if (m_columns) {
+      m_columns->scales[m_row] = _scale;
+      m_columns->previousScales[m_row] = _scale;
+    }
+    else { m_scale = _scale; }
   }
 
   // Getters
   sf::Vector2f
-    getPosition() const { return m_position; }
+    getPosition() const { return m_columns ? m_columns->positions[m_row] : m_position; }
 
   sf::Vector2f
-    getRotation() const { return m_rotation; }
+    getRotation() const { return m_columns ? m_columns->rotations[m_row] : m_rotation; }
 
   sf::Vector2f
-    getScale()    const { return m_scale; }
+    getScale()    const { return m_columns ? m_columns->scales[m_row] : m_scale; }
+
+  /**
+   * @brief Points this Transform at a row of archetype storage.
+   *
+   * Called by Archetype only; the row must already hold this Transform's values.
+   * @param columns Arrays of the owning archetype.
+   * @param row Row of the owning entity inside those arrays.
+   */
+  void
+    bindColumns(TransformColumns* columns, uint32_t row) {
+    m_columns = columns;
+    m_row = row;
+  }
+
+  /**
+   * @brief Copies the current row back into the local fields and detaches from storage.
+   */
+  void
+    unbindColumns() {
+    if (m_columns) {
+      m_position = m_columns->positions[m_row];
+      m_rotation = m_columns->rotations[m_row];
+      m_scale = m_columns->scales[m_row];
+      m_columns = nullptr;
+      m_row = 0;
+    }
+  }
 
 private:
+  sf::Vector2f&
+    positionRef() { return m_columns ? m_columns->positions[m_row] : m_position; }
+
   sf::Vector2f m_position;
   sf::Vector2f m_rotation;
   sf::Vector2f m_scale;
+  TransformColumns* m_columns = nullptr; ///< Archetype arrays, or nullptr when standalone.
+  uint32_t m_row = 0;                    ///< Row inside m_columns.
 };
\ No newline at end of file
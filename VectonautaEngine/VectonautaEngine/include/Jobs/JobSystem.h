@@ -0,0 +1,160 @@
+#pragma once
+
+/**
+ * @file JobSystem.h
+ * @brief Declares the engine job system: worker threads with work-stealing queues.
+ */
+
+#include "../Prerequisites.h"
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <algorithm>
+
+/**
+ * @brief Unit of work run by the job system.
+ */
+using Job = std::function<void()>;
+
+/**
+ * @class JobCounter
+ * @brief Fence that tracks how many jobs of a group are still pending.
+ *
+ * Pass it to JobSystem::schedule() and call JobSystem::wait() to block until the group is done.
+ */
+class
+  JobCounter {
+public:
+  /**
+   * @brief Default constructor. Starts with no pending jobs.
+   */
+  JobCounter() = default;
+
+  JobCounter(const JobCounter&) = delete;
+  JobCounter& operator=(const JobCounter&) = delete;
+
+  /**
+   * @brief Checks whether every job tracked by the counter has finished.
+   */
+  bool
+    isDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+private:
+  friend class JobSystem;
+
+  std::atomic<int32_t> m_pending{ 0 }; ///< Jobs scheduled but not finished.
+};
+
+/**
+ * @class JobSystem
+ * @brief Pool of worker threads that run jobs, with one deque per thread and work stealing.
+ *
+ * A thread pushes and pops jobs at the back of its own deque. Idle workers steal from the front
+ * of other deques. Threads that are not workers (the main thread) share queue 0 and help run
+ * jobs while they wait on a counter, so nested waits never deadlock.
+ */
+class
+  JobSystem {
+public:
+  /**
+   * @brief Starts the worker threads.
+   * @param workerCount Number of workers; 0 uses one less than the hardware thread count.
+   */
+  explicit JobSystem(uint32_t workerCount = 0);
+
+  /**
+   * @brief Stops and joins the worker threads. Pending jobs are dropped.
+   */
+  ~JobSystem();
+
+  JobSystem(const JobSystem&) = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+
+  /**
+   * @brief Queues a job on the calling thread's deque.
+   * @param job Work to run.
+   * @param counter Optional counter incremented now and decremented when the job ends.
+   */
+  void
+    schedule(Job job, JobCounter* counter = nullptr);
+
+  /**
+   * @brief Runs queued jobs on the calling thread until the counter reaches zero.
+   * @param counter Counter to wait on.
+   */
+  void
+    wait(JobCounter& counter);
+
+  /**
+   * @brief Splits [begin, end) into chunks and runs them across all threads, then waits.
+   * @param begin First index.
+   * @param end One past the last index.
+   * @param grainSize Indices per job (at least 1).
+   * @param func Callable taking (uint32_t first, uint32_t last) for one chunk.
+   */
+  template<typename Func>
+  void
+    parallelFor(uint32_t begin, uint32_t end, uint32_t grainSize, Func&& func) {
+    if (begin >= end) {
+      return;
+    }
+    grainSize = grainSize == 0 ? 1 : grainSize;
+
+    // Un solo bloque: no vale la pena pasar por las colas
+    if (end - begin <= grainSize || m_workers.empty()) {
+      func(begin, end);
+      return;
+    }
+
+    JobCounter counter;
+    for (uint32_t first = begin; first < end; first += grainSize) {
+      const uint32_t last = std::min(end, first + grainSize);
+      schedule([&func, first, last]() { func(first, last); }, &counter);
+    }
+    wait(counter);
+  }
+
+  /**
+   * @brief Returns the number of worker threads (the calling thread is not counted).
+   */
+  uint32_t
+    getWorkerCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+private:
+  /**
+   * @struct WorkQueue
+   * @brief Job deque owned by one thread.
+   */
+  struct
+    WorkQueue {
+    std::mutex mutex;    ///< Guards jobs.
+    std::deque<Job> jobs;///< Owner uses the back, thieves the front.
+  };
+
+  /**
+   * @brief Main loop of a worker thread.
+   */
+  void
+    workerLoop(uint32_t queueIndex);
+
+  /**
+   * @brief Pops a local job or steals one, and runs it.
+   * @return true if a job was run.
+   */
+  bool
+    runOne(uint32_t queueIndex);
+
+  /**
+   * @brief Returns the queue index of the calling thread (0 for non-worker threads).
+   */
+  uint32_t
+    currentQueue() const;
+
+  std::vector<EngineUtilities::TUniquePtr<WorkQueue>> m_queues; ///< Queue 0 = external threads, 1..N = workers.
+  std::vector<std::thread> m_workers;                          ///< Worker threads.
+  std::atomic<bool> m_running{ true };                         ///< Cleared on shutdown.
+  std::atomic<uint32_t> m_queuedJobs{ 0 };                     ///< Jobs sitting in any queue.
+  std::mutex m_sleepMutex;                                     ///< Guards sleeping workers.
+  std::condition_variable m_wakeCondition;                     ///< Wakes idle workers.
+};
@@ -0,0 +1,253 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace EngineUtilities {
+	/**
+	 * @brief Reservador lineal para datos que solo viven durante el frame actual y el siguiente.
+	 *
+	 * Reservar solo avanza un desplazamiento atomico y liberar no hace nada. Tiene dos buferes:
+	 * endFrame() cambia de bufer y vacia el que usara el frame siguiente, de modo que lo
+	 * reservado en un frame sigue siendo valido durante el siguiente (por ejemplo, para que el
+	 * render lea los datos del frame anterior).
+	 *
+	 * Si un frame no cabe en su bufer, el exceso se reserva aparte y, la proxima vez que se
+	 * vacia ese bufer, crece lo necesario para cubrirlo. En estado estable no se llama a malloc.
+	 *
+	 * Varios hilos pueden reservar a la vez; endFrame() no debe coincidir con ninguna reserva.
+	 */
+	class FrameArena
+	{
+	public:
+		static constexpr size_t DEFAULT_CAPACITY = 256 * 1024; ///< Bytes iniciales de cada bufer.
+
+		/**
+		 * @brief Constructor.
+		 *
+		 * @param capacity Bytes iniciales de cada uno de los dos buferes.
+		 */
+		explicit FrameArena(size_t capacity = DEFAULT_CAPACITY)
+		{
+			for (Buffer& buffer : m_buffers)
+			{
+				buffer.data = static_cast<unsigned char*>(::operator new(capacity));
+				buffer.capacity = capacity;
+			}
+		}
+
+		/**
+		 * @brief Destructor. Libera ambos buferes y sus reservas extra.
+		 */
+		~FrameArena()
+		{
+			for (Buffer& buffer : m_buffers)
+			{
+				releaseOverflow(buffer);
+				::operator delete(buffer.data);
+			}
+		}
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		/**
+		 * @brief Reserva memoria sin inicializar en el bufer del frame actual.
+		 *
+		 * @param size Bytes a reservar.
+		 * @param alignment Alineacion en bytes; potencia de dos.
+		 * @return Memoria valida hasta el segundo endFrame() posterior.
+		 */
+		void* allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+		{
+			Buffer& buffer = m_buffers[m_current];
+			const uintptr_t base = reinterpret_cast<uintptr_t>(buffer.data);
+			size_t offset = buffer.offset.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				const size_t start = static_cast<size_t>(((base + offset + alignment - 1) & ~(alignment - 1)) - base);
+				const size_t end = start + size;
+				if (end > buffer.capacity)
+				{
+					return allocateOverflow(buffer, size, alignment);
+				}
+				if (buffer.offset.compare_exchange_weak(offset, end, std::memory_order_relaxed))
+				{
+					return buffer.data + start;
+				}
+			}
+		}
+
+		/**
+		 * @brief Reserva un arreglo sin construir de count elementos de tipo T.
+		 *
+		 * @param count Numero de elementos.
+		 */
+		template<typename T>
+		T* allocateArray(size_t count)
+		{
+			return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+		}
+
+		/**
+		 * @brief Termina el frame: cambia de bufer y vacia el que usara el frame siguiente.
+		 *
+		 * Lo reservado en el frame que termina sigue siendo valido hasta la proxima llamada.
+		 */
+		void endFrame()
+		{
+			m_current ^= 1;
+			Buffer& next = m_buffers[m_current];
+			if (next.overflowBytes > 0)
+			{
+				// Crece para que el mismo volumen quepa sin reservas extra
+				size_t capacity = next.capacity * 2;
+				while (capacity < next.capacity + next.overflowBytes)
+				{
+					capacity *= 2;
+				}
+				releaseOverflow(next);
+				::operator delete(next.data);
+				next.data = static_cast<unsigned char*>(::operator new(capacity));
+				next.capacity = capacity;
+				m_heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+			}
+			next.offset.store(0, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Devuelve los bytes reservados en el frame actual, incluidas las reservas extra.
+		 */
+		size_t getUsedBytes() const
+		{
+			const Buffer& buffer = m_buffers[m_current];
+			return buffer.offset.load(std::memory_order_relaxed) + buffer.overflowBytes;
+		}
+
+		/**
+		 * @brief Devuelve la capacidad del bufer del frame actual.
+		 */
+		size_t getCapacity() const { return m_buffers[m_current].capacity; }
+
+		/**
+		 * @brief Devuelve cuantas veces la arena pidio memoria al heap desde que se creo.
+		 *
+		 * Cuenta las reservas que no cupieron en su bufer y los buferes que crecieron por ellas,
+		 * sin los dos buferes iniciales. Si no cambia entre dos frames, ese frame no llamo a malloc
+		 * para nada de lo que vive en la arena.
+		 */
+		uint64_t getHeapAllocationCount() const { return m_heapAllocationCount.load(std::memory_order_relaxed); }
+
+	private:
+		/**
+		 * @brief Uno de los dos buferes.
+		 */
+		struct Buffer
+		{
+			unsigned char* data = nullptr;     ///< Memoria del bufer.
+			size_t capacity = 0;               ///< Bytes de data.
+			std::atomic<size_t> offset{ 0 };   ///< Primer byte libre de data.
+			std::vector<void*> overflow;       ///< Reservas que no cupieron en data.
+			size_t overflowBytes = 0;          ///< Bytes reservados en overflow.
+		};
+
+		/**
+		 * @brief Reserva fuera del bufer cuando este se llena (camino lento).
+		 */
+		void* allocateOverflow(Buffer& buffer, size_t size, size_t alignment)
+		{
+			std::lock_guard<std::mutex> lock(m_overflowMutex);
+			void* raw = ::operator new(size + alignment);
+			buffer.overflow.push_back(raw);
+			buffer.overflowBytes += size + alignment;
+			m_heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+			const uintptr_t address = reinterpret_cast<uintptr_t>(raw);
+			return reinterpret_cast<void*>((address + alignment - 1) & ~(alignment - 1));
+		}
+
+		/**
+		 * @brief Libera las reservas extra de un bufer.
+		 */
+		static void releaseOverflow(Buffer& buffer)
+		{
+			for (void* raw : buffer.overflow)
+			{
+				::operator delete(raw);
+			}
+			buffer.overflow.clear();
+			buffer.overflowBytes = 0;
+		}
+
+		Buffer m_buffers[2];                              ///< Bufer del frame actual y del anterior.
+		uint32_t m_current = 0;                           ///< Indice del bufer del frame actual.
+		std::mutex m_overflowMutex;                       ///< Protege las reservas extra.
+		std::atomic<uint64_t> m_heapAllocationCount{ 0 }; ///< Reservas extra y crecimientos de buferes.
+	};
+
+	/**
+	 * @brief Adaptador para usar una FrameArena con contenedores de la STL.
+	 *
+	 * deallocate() no hace nada: la memoria vuelve a la arena en endFrame(). Cada vez que un
+	 * vector crece deja su bloque anterior en la arena, asi que conviene llamar a reserve().
+	 *
+	 * @tparam T Tipo de los elementos.
+	 */
+	template<typename T>
+	class TFrameAllocator
+	{
+	public:
+		using value_type = T; ///< Tipo de los elementos.
+
+		/**
+		 * @brief Constructor.
+		 *
+		 * @param arena Arena de la que se reserva; debe sobrevivir al contenedor.
+		 */
+		explicit TFrameAllocator(FrameArena& arena) noexcept : m_arena(&arena) {}
+
+		/**
+		 * @brief Constructor de conversion entre tipos de elemento (rebind).
+		 */
+		template<typename U>
+		TFrameAllocator(const TFrameAllocator<U>& other) noexcept : m_arena(other.getArena()) {}
+
+		/**
+		 * @brief Reserva count elementos en la arena.
+		 */
+		T* allocate(size_t count) { return m_arena->allocateArray<T>(count); }
+
+		/**
+		 * @brief No hace nada; la arena se vacia entera en endFrame().
+		 */
+		void deallocate(T*, size_t) noexcept {}
+
+		/**
+		 * @brief Devuelve la arena usada.
+		 */
+		FrameArena* getArena() const noexcept { return m_arena; }
+
+	private:
+		FrameArena* m_arena; ///< Arena de la que se reserva.
+	};
+
+	template<typename T, typename U>
+	bool operator==(const TFrameAllocator<T>& lhs, const TFrameAllocator<U>& rhs) noexcept
+	{
+		return lhs.getArena() == rhs.getArena();
+	}
+
+	template<typename T, typename U>
+	bool operator!=(const TFrameAllocator<T>& lhs, const TFrameAllocator<U>& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	/**
+	 * @brief Vector cuyos elementos viven en una FrameArena.
+	 */
+	template<typename T>
+	using TFrameVector = std::vector<T, TFrameAllocator<T>>;
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <atomic>
+
+namespace EngineUtilities {
+	/**
+	 * @brief Poltica de conteo de referencias para objetos usados por un solo hilo.
+	 *
+	 * Usa un entero normal: es la opcin ms barata, pero no se puede compartir el
+	 * puntero entre hilos.
+	 */
+	struct SingleThreadRefCount
+	{
+		using CountType = int; ///< Tipo del contador.
+
+		/**
+		 * @brief Incrementa el contador.
+		 */
+		static void increment(CountType& count) { ++count; }
+
+		/**
+		 * @brief Decrementa el contador.
+		 *
+		 * @return true si el contador lleg a cero.
+		 */
+		static bool decrement(CountType& count) { return --count == 0; }
+
+		/**
+		 * @brief Incrementa el contador solo si no es cero.
+		 *
+		 * @return true si se pudo incrementar.
+		 */
+		static bool incrementIfNotZero(CountType& count)
+		{
+			if (count == 0)
+			{
+				return false;
+			}
+			++count;
+			return true;
+		}
+
+		/**
+		 * @brief Lee el valor actual del contador.
+		 */
+		static int load(const CountType& count) { return count; }
+	};
+
+	/**
+	 * @brief Poltica de conteo de referencias segura entre hilos.
+	 *
+	 * Los incrementos son relaxed (solo hace falta que sean atmicos). El decremento usa
+	 * release y, cuando llega a cero, un fence acquire, para que el hilo que destruye el
+	 * objeto vea todas las escrituras hechas por los demas dueos.
+	 */
+	struct AtomicRefCount
+	{
+		using CountType = std::atomic<int>; ///< Tipo del contador.
+
+		/**
+		 * @brief Incrementa el contador.
+		 */
+		static void increment(CountType& count)
+		{
+			count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Decrementa el contador.
+		 *
+		 * @return true si el contador lleg a cero.
+		 */
+		static bool decrement(CountType& count)
+		{
+			if (count.fetch_sub(1, std::memory_order_release) == 1)
+			{
+				std::atomic_thread_fence(std::memory_order_acquire);
+				return true;
+			}
+			return false;
+		}
+
+		/**
+		 * @brief Incrementa el contador solo si no es cero.
+		 *
+		 * Se usa al promover un TWeakPointer: si otro hilo ya solt la ltima referencia
+		 * el objeto no puede revivir.
+		 *
+		 * @return true si se pudo incrementar.
+		 */
+		static bool incrementIfNotZero(CountType& count)
+		{
+			int current = count.load(std::memory_order_relaxed);
+			while (current != 0)
+			{
+				if (count.compare_exchange_weak(current, current + 1, std::memory_order_acquire,
+				                                std::memory_order_relaxed))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/**
+		 * @brief Lee el valor actual del contador.
+		 */
+		static int load(const CountType& count) { return count.load(std::memory_order_acquire); }
+	};
+}
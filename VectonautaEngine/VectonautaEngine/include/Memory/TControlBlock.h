@@ -0,0 +1,151 @@
+#pragma once
+#include "RefCountPolicy.h"
+#include <new>
+#include <utility>
+
+namespace EngineUtilities {
+	/**
+	 * @brief Bloque de control compartido por todos los TSharedPointer de un mismo objeto.
+	 *
+	 * Guarda el recuento de referencias y sabe cmo destruir el objeto gestionado y
+	 * liberar su propia memoria, sin importar el tipo esttico con el que se apunte.
+	 *
+	 * Lleva dos contadores: strongCount (TSharedPointer vivos) decide cundo se destruye
+	 * el objeto, y weakCount (TWeakPointer vivos, ms uno mientras haya fuertes) decide
+	 * cundo se libera el bloque. As un TWeakPointer puede consultar el bloque aunque el
+	 * objeto ya no exista.
+	 *
+	 * @tparam RefCountPolicy Poltica del contador (ver RefCountPolicy.h).
+	 */
+	template<typename RefCountPolicy>
+	class TControlBlock
+	{
+	public:
+		using CountType = typename RefCountPolicy::CountType; ///< Tipo del contador.
+
+		/**
+		 * @brief Constructor. El bloque nace con una referencia.
+		 */
+		TControlBlock() : strongCount(1), weakCount(1) {}
+
+		/**
+		 * @brief Destructor virtual.
+		 */
+		virtual ~TControlBlock() = default;
+
+		/**
+		 * @brief Suma una referencia.
+		 */
+		void addReference() { RefCountPolicy::increment(strongCount); }
+
+		/**
+		 * @brief Suma una referencia solo si el objeto sigue vivo.
+		 *
+		 * @return true si se obtuvo la referencia.
+		 */
+		bool tryAddReference() { return RefCountPolicy::incrementIfNotZero(strongCount); }
+
+		/**
+		 * @brief Quita una referencia; destruye el objeto al llegar a cero.
+		 */
+		void releaseReference()
+		{
+			if (RefCountPolicy::decrement(strongCount))
+			{
+				destroyObject();
+				releaseWeakReference();
+			}
+		}
+
+		/**
+		 * @brief Suma un observador dbil.
+		 */
+		void addWeakReference() { RefCountPolicy::increment(weakCount); }
+
+		/**
+		 * @brief Quita un observador dbil; libera el bloque al llegar a cero.
+		 */
+		void releaseWeakReference()
+		{
+			if (RefCountPolicy::decrement(weakCount))
+			{
+				destroyBlock();
+			}
+		}
+
+		/**
+		 * @brief Devuelve el nmero de TSharedPointer que apuntan al objeto.
+		 */
+		int useCount() const { return RefCountPolicy::load(strongCount); }
+
+	protected:
+		/**
+		 * @brief Destruye el objeto gestionado.
+		 */
+		virtual void destroyObject() = 0;
+
+		/**
+		 * @brief Libera la memoria del bloque de control.
+		 */
+		virtual void destroyBlock() = 0;
+
+		CountType strongCount; ///< Nmero de TSharedPointer vivos.
+		CountType weakCount;   ///< TWeakPointer vivos, ms uno mientras strongCount > 0.
+	};
+
+	/**
+	 * @brief Bloque de control para un objeto reservado por separado (TSharedPointer(T*)).
+	 */
+	template<typename T, typename RefCountPolicy>
+	class TPointerControlBlock : public TControlBlock<RefCountPolicy>
+	{
+	public:
+		/**
+		 * @brief Constructor.
+		 *
+		 * @param object Objeto del que el bloque toma la propiedad.
+		 */
+		explicit TPointerControlBlock(T* object) : m_object(object) {}
+
+	protected:
+		void destroyObject() override { delete m_object; }
+		void destroyBlock() override { delete this; }
+
+	private:
+		T* m_object; ///< Objeto gestionado.
+	};
+
+	/**
+	 * @brief Bloque de control que contiene al objeto en la misma reserva (MakeShared).
+	 *
+	 * El objeto y el contador quedan juntos en memoria: una sola reserva y la misma lnea
+	 * de cach para el contador y el inicio del objeto.
+	 */
+	template<typename T, typename RefCountPolicy>
+	class TInplaceControlBlock : public TControlBlock<RefCountPolicy>
+	{
+	public:
+		/**
+		 * @brief Construye el objeto dentro del bloque.
+		 *
+		 * @param args Argumentos reenviados al constructor de T.
+		 */
+		template<typename... Args>
+		explicit TInplaceControlBlock(Args&&... args)
+		{
+			new (static_cast<void*>(m_storage)) T(std::forward<Args>(args)...);
+		}
+
+		/**
+		 * @brief Devuelve el objeto alojado en el bloque.
+		 */
+		T* get() { return std::launder(reinterpret_cast<T*>(m_storage)); }
+
+	protected:
+		void destroyObject() override { get()->~T(); }
+		void destroyBlock() override { delete this; }
+
+	private:
+		alignas(T) unsigned char m_storage[sizeof(T)]; ///< Memoria del objeto.
+	};
+}
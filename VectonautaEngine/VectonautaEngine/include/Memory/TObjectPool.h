@@ -0,0 +1,377 @@
+#pragma once
+#include "RefCountPolicy.h"
+#include "TControlBlock.h"
+#include "TSharedPointer.h"
+#include "TUniquePtr.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace EngineUtilities {
+	/**
+	 * @brief Pool de objetos de un solo tipo reservados en bloques (slabs) contiguos.
+	 *
+	 * Cada slab guarda ObjectsPerSlab huecos seguidos; los huecos libres forman una lista
+	 * enlazada dentro de la propia memoria libre. Los objetos no se mueven y la memoria de
+	 * los slabs no se devuelve al sistema hasta destruir el pool, asi que crear y destruir
+	 * objetos en bucle no fragmenta el heap y los objetos creados juntos quedan juntos.
+	 *
+	 * El pool compartido de cada tipo (get()) tiene ademas una cache por hilo: reservar y
+	 * liberar no toman el mutex salvo para mover lotes de huecos entre la cache y el pool.
+	 *
+	 * @tparam T Tipo de los objetos.
+	 * @tparam ObjectsPerSlab Huecos por slab.
+	 */
+	template<typename T, size_t ObjectsPerSlab = 64>
+	class TObjectPool
+	{
+	public:
+		/**
+		 * @brief Constructor.
+		 *
+		 * @param threadCache true para usar la cache por hilo. Solo un pool por tipo puede
+		 * usarla y debe sobrevivir a todos los hilos que reserven de el (como el de get()).
+		 */
+		explicit TObjectPool(bool threadCache = false) : m_threadCache(threadCache) {}
+
+		/**
+		 * @brief Destructor. Libera los slabs; no destruye los objetos que sigan vivos.
+		 */
+		~TObjectPool()
+		{
+			for (void* slab : m_slabs)
+			{
+				::operator delete(slab, std::align_val_t(alignof(Slot)));
+			}
+		}
+
+		TObjectPool(const TObjectPool&) = delete;
+		TObjectPool& operator=(const TObjectPool&) = delete;
+
+		/**
+		 * @brief Devuelve el pool compartido del tipo, con cache por hilo.
+		 *
+		 * No se destruye nunca, para que los objetos liberados al cerrar el programa y las
+		 * caches de los hilos que terminan tarde tengan siempre a donde volver.
+		 */
+		static TObjectPool& get()
+		{
+			static TObjectPool* pool = new TObjectPool(true);
+			return *pool;
+		}
+
+		/**
+		 * @brief Reserva un hueco sin construir.
+		 *
+		 * @return Memoria para un T.
+		 */
+		void* allocate()
+		{
+			ThreadCache& cache = s_cache;
+			if (usesCache(cache))
+			{
+				if (cache.head == nullptr)
+				{
+					refill(cache);
+				}
+				Slot* slot = cache.head;
+				cache.head = slot->next;
+				--cache.count;
+				return slot;
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_free == nullptr)
+			{
+				addSlab();
+			}
+			Slot* slot = m_free;
+			m_free = slot->next;
+			return slot;
+		}
+
+		/**
+		 * @brief Devuelve al pool un hueco obtenido con allocate().
+		 *
+		 * @param memory Hueco cuyo objeto ya fue destruido.
+		 */
+		void deallocate(void* memory)
+		{
+			Slot* slot = static_cast<Slot*>(memory);
+			ThreadCache& cache = s_cache;
+			if (usesCache(cache))
+			{
+				slot->next = cache.head;
+				cache.head = slot;
+				if (++cache.count > 2 * CACHE_BATCH)
+				{
+					drain(cache, CACHE_BATCH);
+				}
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			slot->next = m_free;
+			m_free = slot;
+		}
+
+		/**
+		 * @brief Construye un T en un hueco del pool.
+		 *
+		 * @param args Argumentos reenviados al constructor de T.
+		 */
+		template<typename... Args>
+		T* create(Args&&... args)
+		{
+			void* memory = allocate();
+			try
+			{
+				return new (memory) T(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				deallocate(memory);
+				throw;
+			}
+		}
+
+		/**
+		 * @brief Destruye un objeto creado con create() y devuelve su hueco.
+		 */
+		void destroy(T* object)
+		{
+			if (object)
+			{
+				object->~T();
+				deallocate(object);
+			}
+		}
+
+		/**
+		 * @brief Devuelve el numero de slabs reservados.
+		 */
+		size_t getSlabCount() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_slabs.size();
+		}
+
+		/**
+		 * @brief Devuelve el numero de huecos, ocupados o libres.
+		 */
+		size_t getCapacity() const { return getSlabCount() * ObjectsPerSlab; }
+
+	private:
+		static constexpr uint32_t CACHE_BATCH = 32; ///< Huecos que se mueven de una vez entre cache y pool.
+
+		/**
+		 * @brief Hueco: el objeto cuando esta ocupado, el enlace de la lista cuando esta libre.
+		 */
+		union Slot
+		{
+			Slot* next;                                    ///< Siguiente hueco libre.
+			alignas(T) unsigned char storage[sizeof(T)];   ///< Memoria del objeto.
+		};
+
+		/**
+		 * @brief Huecos libres que un hilo tiene reservados para si.
+		 */
+		struct ThreadCache
+		{
+			TObjectPool* owner = nullptr; ///< Pool al que pertenecen los huecos.
+			Slot* head = nullptr;         ///< Primer hueco libre.
+			uint32_t count = 0;           ///< Huecos en la lista.
+
+			~ThreadCache()
+			{
+				if (owner)
+				{
+					owner->drain(*this, count);
+				}
+			}
+		};
+
+		/**
+		 * @brief Indica si las reservas de este hilo pasan por la cache, reclamandola si esta libre.
+		 */
+		bool usesCache(ThreadCache& cache)
+		{
+			if (!m_threadCache)
+			{
+				return false;
+			}
+			if (cache.owner == nullptr)
+			{
+				cache.owner = this;
+			}
+			return cache.owner == this;
+		}
+
+		/**
+		 * @brief Pasa un lote de huecos del pool a la cache.
+		 */
+		void refill(ThreadCache& cache)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			while (cache.count < CACHE_BATCH)
+			{
+				if (m_free == nullptr)
+				{
+					addSlab();
+				}
+				Slot* slot = m_free;
+				m_free = slot->next;
+				slot->next = cache.head;
+				cache.head = slot;
+				++cache.count;
+			}
+		}
+
+		/**
+		 * @brief Devuelve count huecos de la cache al pool.
+		 */
+		void drain(ThreadCache& cache, uint32_t count)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			for (uint32_t i = 0; i < count && cache.head != nullptr; ++i)
+			{
+				Slot* slot = cache.head;
+				cache.head = slot->next;
+				--cache.count;
+				slot->next = m_free;
+				m_free = slot;
+			}
+		}
+
+		/**
+		 * @brief Reserva un slab y encadena sus huecos a la lista libre. Requiere m_mutex.
+		 */
+		void addSlab()
+		{
+			Slot* slab = static_cast<Slot*>(::operator new(sizeof(Slot) * ObjectsPerSlab,
+			                                               std::align_val_t(alignof(Slot))));
+			m_slabs.push_back(slab);
+			// Se encadena al reves para que los huecos salgan en orden de direccion
+			for (size_t i = ObjectsPerSlab; i > 0; --i)
+			{
+				slab[i - 1].next = m_free;
+				m_free = &slab[i - 1];
+			}
+		}
+
+		inline static thread_local ThreadCache s_cache; ///< Cache del hilo actual.
+
+		const bool m_threadCache;    ///< Si este pool usa la cache por hilo.
+		mutable std::mutex m_mutex;  ///< Protege m_free y m_slabs.
+		Slot* m_free = nullptr;      ///< Primer hueco libre del pool.
+		std::vector<void*> m_slabs;  ///< Slabs reservados.
+	};
+
+	/**
+	 * @brief Bloque de control con el objeto dentro (como MakeShared) reservado en un TObjectPool.
+	 *
+	 * Al liberarse vuelve al pool compartido de su tipo en lugar de llamar a delete.
+	 */
+	template<typename T, typename RefCountPolicy>
+	class TPooledControlBlock : public TInplaceControlBlock<T, RefCountPolicy>
+	{
+	public:
+		using Pool = TObjectPool<TPooledControlBlock>; ///< Pool de los bloques.
+
+		/**
+		 * @brief Construye el objeto dentro del bloque.
+		 *
+		 * @param args Argumentos reenviados al constructor de T.
+		 */
+		template<typename... Args>
+		explicit TPooledControlBlock(Args&&... args)
+			: TInplaceControlBlock<T, RefCountPolicy>(std::forward<Args>(args)...) {}
+
+	protected:
+		void destroyBlock() override { Pool::get().destroy(this); }
+	};
+
+	/**
+	 * @brief Borrador de TUniquePtr que devuelve el objeto al pool compartido de su tipo.
+	 */
+	template<typename T>
+	struct TPoolDelete
+	{
+		void operator()(T* object) const { TObjectPool<T>::get().destroy(object); }
+	};
+
+	/**
+	 * @brief TUniquePtr cuyo objeto vive en el pool compartido de su tipo.
+	 */
+	template<typename T>
+	using TPooledUniquePtr = TUniquePtr<T, TPoolDelete<T>>;
+
+	/**
+	 * @brief Interruptor global de MakePooledShared; activado por defecto.
+	 */
+	inline std::atomic<bool> g_poolingEnabled{ true };
+
+	/**
+	 * @brief Activa o desactiva los pools de MakePooledShared (por ejemplo, para compararlos con MakeShared).
+	 *
+	 * Se puede cambiar en cualquier momento: cada bloque recuerda si vino de un pool o del heap.
+	 */
+	inline void SetPoolingEnabled(bool enabled) { g_poolingEnabled.store(enabled, std::memory_order_relaxed); }
+
+	/**
+	 * @brief Indica si MakePooledShared reserva en los pools.
+	 */
+	inline bool IsPoolingEnabled() { return g_poolingEnabled.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Crea un TSharedPointer cuyo objeto y bloque de control viven en un TObjectPool.
+	 *
+	 * Con los pools desactivados (SetPoolingEnabled) equivale a MakeSharedWithPolicy.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam RefCountPolicy Politica del contador.
+	 * @param args Argumentos reenviados al constructor del objeto gestionado.
+	 */
+	template<typename T, typename RefCountPolicy, typename... Args>
+	TSharedPointer<T, RefCountPolicy> MakePooledSharedWithPolicy(Args&&... args)
+	{
+		if (!IsPoolingEnabled())
+		{
+			return MakeSharedWithPolicy<T, RefCountPolicy>(std::forward<Args>(args)...);
+		}
+		using Block = TPooledControlBlock<T, RefCountPolicy>;
+		Block* block = Block::Pool::get().create(std::forward<Args>(args)...);
+		return TSharedPointer<T, RefCountPolicy>(block->get(), block,
+		                                         typename TSharedPointer<T, RefCountPolicy>::AdoptBlock());
+	}
+
+	/**
+	 * @brief Como MakeShared, pero reservando en el pool compartido del tipo.
+	 *
+	 * Pensado para objetos que se crean y destruyen a menudo (actores y sus componentes).
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @param args Argumentos reenviados al constructor del objeto gestionado.
+	 */
+	template<typename T, typename... Args>
+	TSharedPointer<T> MakePooledShared(Args&&... args)
+	{
+		return MakePooledSharedWithPolicy<T, SingleThreadRefCount>(std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief Como MakeUnique, pero reservando en el pool compartido del tipo.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @param args Argumentos reenviados al constructor del objeto gestionado.
+	 */
+	template<typename T, typename... Args>
+	TPooledUniquePtr<T> MakePooledUnique(Args&&... args)
+	{
+		return TPooledUniquePtr<T>(TObjectPool<T>::get().create(std::forward<Args>(args)...));
+	}
+}
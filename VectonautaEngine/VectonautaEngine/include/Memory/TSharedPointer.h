@@ -27,6 +27,8 @@
  * SOFTWARE.
 */
 #pragma once
+#include "RefCountPolicy.h"
+#include "TControlBlock.h"
 
 namespace EngineUtilities {
 	/**
@@ -34,96 +36,119 @@ namespace EngineUtilities {
 	 *
 	 * La clase TSharedPointer gestiona la memoria de un objeto de tipo T y lleva un
 	 * recuento de referencias para permitir la comparticin segura de un mismo objeto
-	 * en mltiples instancias de TSharedPointer.
+	 * en mltiples instancias de TSharedPointer. El recuento vive en un TControlBlock;
+	 * MakeShared reserva el objeto y el bloque juntos en una sola reserva.
+	 *
+	 * @tparam RefCountPolicy Poltica del contador: SingleThreadRefCount (por defecto,
+	 * sin atmicos) o AtomicRefCount para punteros compartidos entre hilos.
 	 */
-	template<typename T>
+	template<typename T, typename RefCountPolicy = SingleThreadRefCount>
 	class TSharedPointer
 	{
 	public:
+		using ControlBlock = TControlBlock<RefCountPolicy>; ///< Tipo del bloque de control.
+
+		/**
+		 * @brief Etiqueta para adoptar un bloque de control sin sumar una referencia.
+		 */
+		struct AdoptBlock {};
+
 		/**
 		 * @brief Constructor por defecto.
 		 *
-		 * Inicializa el puntero y el recuento de referencias a nullptr.
+		 * Inicializa el puntero y el bloque de control a nullptr.
 		 */
-		TSharedPointer() : ptr(nullptr), refCount(nullptr) {}
+		TSharedPointer() : ptr(nullptr), controlBlock(nullptr) {}
 
 		/**
 		 * @brief Constructor que toma un puntero crudo.
 		 *
 		 * @param rawPtr Puntero crudo al objeto que se va a gestionar.
 		 */
-		explicit TSharedPointer(T* rawPtr) : ptr(rawPtr), refCount(new int(1)) {}
+		explicit TSharedPointer(T* rawPtr)
+			: ptr(rawPtr),
+			controlBlock(rawPtr ? new TPointerControlBlock<T, RefCountPolicy>(rawPtr) : nullptr) {}
 
 		/**
-		 * @brief Constructor desde un puntero crudo y un recuento de referencias.
+		 * @brief Constructor desde un puntero crudo y un bloque de control existente.
+		 *
+		 * Suma una referencia al bloque; el puntero puede ser una base o parte del objeto.
 		 *
 		 * @param rawPtr Puntero crudo al objeto gestionado.
-		 * @param existingRefCount Puntero al recuento de referencias existente.
+		 * @param existingBlock Bloque de control existente.
 		 */
-		TSharedPointer(T* rawPtr, int* existingRefCount) : ptr(rawPtr), refCount(existingRefCount)
+		TSharedPointer(T* rawPtr, ControlBlock* existingBlock) : ptr(rawPtr), controlBlock(existingBlock)
 		{
-			if (refCount)
+			if (controlBlock)
 			{
-				++(*refCount);
+				controlBlock->addReference();
 			}
 		}
 
+		/**
+		 * @brief Constructor que adopta la referencia inicial de un bloque recin creado.
+		 *
+		 * @param rawPtr Puntero crudo al objeto gestionado.
+		 * @param newBlock Bloque de control cuya primera referencia pasa a este puntero.
+		 */
+		TSharedPointer(T* rawPtr, ControlBlock* newBlock, AdoptBlock) : ptr(rawPtr), controlBlock(newBlock) {}
+
 		/**
 		 * @brief Constructor de copia.
 		 *
-		 * Copia el puntero y el recuento de referencias del otro TSharedPointer y
+		 * Copia el puntero y el bloque de control del otro TSharedPointer y
 		 * aumenta el recuento de referencias.
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		TSharedPointer(const TSharedPointer<T>& other) : ptr(other.ptr), refCount(other.refCount)
+		TSharedPointer(const TSharedPointer& other) : ptr(other.ptr), controlBlock(other.controlBlock)
 		{
-			if (refCount)
+			if (controlBlock)
 			{
-				++(*refCount);
+				controlBlock->addReference();
 			}
 		}
 
 		/**
 		 * @brief Constructor de movimiento.
 		 *
-		 * Transfiere la propiedad del puntero y el recuento de referencias del otro
+		 * Transfiere la propiedad del puntero y el bloque de control del otro
 		 * TSharedPointer al nuevo objeto TSharedPointer.
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		TSharedPointer(TSharedPointer<T>&& other) noexcept : ptr(other.ptr), refCount(other.refCount)
+		TSharedPointer(TSharedPointer&& other) noexcept : ptr(other.ptr), controlBlock(other.controlBlock)
 		{
 			other.ptr = nullptr;
-			other.refCount = nullptr;
+			other.controlBlock = nullptr;
 		}
 
 		/**
 		 * @brief Operador de asignacin de copia.
 		 *
-		 * Libera el objeto actual, copia el puntero y el recuento de referencias del otro
+		 * Libera el objeto actual, copia el puntero y el bloque de control del otro
 		 * TSharedPointer, y aumenta el recuento de referencias.
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 * @return Referencia al objeto TSharedPointer actual.
 		 */
-		TSharedPointer<T>& operator=(const TSharedPointer<T>& other)
+		TSharedPointer& operator=(const TSharedPointer& other)
 		{
 			if (this != &other)
 			{
+				// Sumar primero por si ambos comparten el mismo bloque
+				if (other.controlBlock)
+				{
+					other.controlBlock->addReference();
+				}
 				// Disminuir el recuento de referencias del objeto actual
-				if (refCount && --(*refCount) == 0)
+				if (controlBlock)
 				{
-					delete ptr;
-					delete refCount;
+					controlBlock->releaseReference();
 				}
 				// Copiar datos del otro puntero compartido
 				ptr = other.ptr;
-				refCount = other.refCount;
-				if (refCount)
-				{
-					++(*refCount);
-				}
+				controlBlock = other.controlBlock;
 			}
 			return *this;
 		}
@@ -131,49 +156,47 @@ namespace EngineUtilities {
 		/**
 		 * @brief Operador de asignacin de movimiento.
 		 *
-		 * Libera el objeto actual, transfiere la propiedad del puntero y el recuento de
-		 * referencias del otro TSharedPointer al actual.
+		 * Libera el objeto actual, transfiere la propiedad del puntero y el bloque de
+		 * control del otro TSharedPointer al actual.
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 * @return Referencia al objeto TSharedPointer actual.
 		 */
-		TSharedPointer<T>& operator=(TSharedPointer<T>&& other) noexcept
+		TSharedPointer& operator=(TSharedPointer&& other) noexcept
 		{
 			if (this != &other)
 			{
 				// Liberar el objeto actual
-				if (refCount && --(*refCount) == 0)
+				if (controlBlock)
 				{
-					delete ptr;
-					delete refCount;
+					controlBlock->releaseReference();
 				}
 				// Transferir los datos del otro puntero compartido
 				ptr = other.ptr;
-				refCount = other.refCount;
+				controlBlock = other.controlBlock;
 				other.ptr = nullptr;
-				other.refCount = nullptr;
+				other.controlBlock = nullptr;
 			}
 			return *this;
 		}
 
 		template<typename U>
-		TSharedPointer(const TSharedPointer<U>& other)
-			: ptr(other.ptr), refCount(other.refCount) {
-			if (refCount) ++(*refCount);
+		TSharedPointer(const TSharedPointer<U, RefCountPolicy>& other)
+			: ptr(other.ptr), controlBlock(other.controlBlock) {
+			if (controlBlock) controlBlock->addReference();
 		}
 
 		/**
 		 * @brief Destructor.
 		 *
-		 * Disminuye el recuento de referencias y libera la memoria del objeto
-		 * gestionado si el recuento de referencias llega a cero.
+		 * Disminuye el recuento de referencias; el bloque de control destruye el objeto
+		 * gestionado si el recuento llega a cero.
 		 */
 		~TSharedPointer()
 		{
-			if (refCount && --(*refCount) == 0)
+			if (controlBlock)
 			{
-				delete ptr;
-				delete refCount;
+				controlBlock->releaseReference();
 			}
 		}
 
@@ -210,9 +233,14 @@ namespace EngineUtilities {
 		 */
 		bool isNull() const { return ptr == nullptr; }
 
+		/**
+		 * @brief Nmero de TSharedPointer que comparten el objeto (0 si es nulo).
+		 */
+		int useCount() const { return controlBlock ? controlBlock->useCount() : 0; }
+
 	public:
 		T* ptr;       ///< Puntero al objeto gestionado.
-		int* refCount; ///< Puntero al recuento de referencias.
+		ControlBlock* controlBlock; ///< Bloque de control con el recuento de referencias.
 
 		/**
 		 * @brief Mtodo swap.
@@ -221,16 +249,16 @@ namespace EngineUtilities {
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		void swap(TSharedPointer<T>& other) noexcept
+		void swap(TSharedPointer& other) noexcept
 		{
 			T* tempPtr = other.ptr;
-			int* tempRefCount = other.refCount;
+			ControlBlock* tempBlock = other.controlBlock;
 
 			other.ptr = this->ptr;
-			other.refCount = this->refCount;
+			other.controlBlock = this->controlBlock;
 
 			this->ptr = tempPtr;
-			this->refCount = tempRefCount;
+			this->controlBlock = tempBlock;
 		}
 
 		/**
@@ -241,55 +269,92 @@ namespace EngineUtilities {
 		void reset(T* newPtr = nullptr)
 		{
 			// Disminuir el recuento de referencias del objeto actual
-			if (refCount && --(*refCount) == 0)
+			if (controlBlock)
 			{
-				delete ptr;
-				delete refCount;
+				controlBlock->releaseReference();
 			}
 
-			// Si newPtr es nullptr, asignar nullptr al puntero y recuento de referencias
+			// Si newPtr es nullptr, asignar nullptr al puntero y al bloque de control
 			if (newPtr == nullptr)
 			{
 				ptr = nullptr;
-				refCount = nullptr;
+				controlBlock = nullptr;
 			}
 			else
 			{
-				// Asignar nuevo objeto y manejar el recuento de referencias
+				// Asignar nuevo objeto con su propio bloque de control
 				ptr = newPtr;
-				refCount = new int(1);
+				controlBlock = new TPointerControlBlock<T, RefCountPolicy>(newPtr);
 			}
 		}
 
 		// Mtodo de conversin para hacer cast dinmico
 		template<typename U>
-		TSharedPointer<U> dynamic_pointer_cast() const {
+		TSharedPointer<U, RefCountPolicy> dynamic_pointer_cast() const {
 			// Intenta convertir el puntero de tipo T a U
 			U* castedPtr = dynamic_cast<U*>(ptr);
 			if (castedPtr) {
 				// Si la conversin es exitosa, devuelve un nuevo TSharedPointer<U>
-				return TSharedPointer<U>(castedPtr, refCount);
+				return TSharedPointer<U, RefCountPolicy>(castedPtr, controlBlock);
 			}
 			else {
 				// Si falla la conversin, devuelve un TSharedPointer<U> nulo
-				return TSharedPointer<U>();
+				return TSharedPointer<U, RefCountPolicy>();
 			}
 		}
 
 	};
 
+	/**
+	 * @brief Crea un TSharedPointer con el objeto y el bloque de control en una sola reserva.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam RefCountPolicy Poltica del contador.
+	 * @param args Argumentos reenviados al constructor del objeto gestionado.
+	 * @return Un objeto TSharedPointer gestionando un nuevo objeto de tipo T.
+	 */
+	template<typename T, typename RefCountPolicy, typename... Args>
+	TSharedPointer<T, RefCountPolicy> MakeSharedWithPolicy(Args&&... args)
+	{
+		auto* block = new TInplaceControlBlock<T, RefCountPolicy>(std::forward<Args>(args)...);
+		return TSharedPointer<T, RefCountPolicy>(block->get(), block,
+		                                         typename TSharedPointer<T, RefCountPolicy>::AdoptBlock());
+	}
+
 	/**
 	 * @brief Funcin de utilidad para crear un TSharedPointer.
 	 *
+	 * El objeto y su recuento de referencias comparten una nica reserva de memoria.
+	 *
 	 * @tparam T Tipo del objeto gestionado.
 	 * @tparam Args Tipos de los argumentos del constructor del objeto gestionado.
-	 * @param args Argumentos del constructor del objeto gestionado.
+	 * @param args Argumentos reenviados al constructor del objeto gestionado.
 	 * @return Un objeto TSharedPointer gestionando un nuevo objeto de tipo T.
 	 */
 	template<typename T, typename... Args>
-	TSharedPointer<T> MakeShared(Args... args)
+	TSharedPointer<T> MakeShared(Args&&... args)
+	{
+		return MakeSharedWithPolicy<T, SingleThreadRefCount>(std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief TSharedPointer con contador atmico, para objetos compartidos entre hilos.
+	 */
+	template<typename T>
+	using TAtomicSharedPointer = TSharedPointer<T, AtomicRefCount>;
+
+	/**
+	 * @brief Funcin de utilidad para crear un TAtomicSharedPointer.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam Args Tipos de los argumentos del constructor del objeto gestionado.
+	 * @param args Argumentos reenviados al constructor del objeto gestionado.
+	 * @return Un objeto TAtomicSharedPointer gestionando un nuevo objeto de tipo T.
+	 */
+	template<typename T, typename... Args>
+	TAtomicSharedPointer<T> MakeAtomicShared(Args&&... args)
 	{
-		return TSharedPointer<T>(new T(args...));
+		return MakeSharedWithPolicy<T, AtomicRefCount>(std::forward<Args>(args)...);
 	}
 
 }
\ No newline at end of file
@@ -29,14 +29,26 @@
 #pragma once
 
 namespace EngineUtilities {
+  /**
+   * @brief Borrador por defecto de TUniquePtr: libera el objeto con delete.
+   */
+  template<typename T>
+  struct TDefaultDelete
+  {
+    void operator()(T* object) const { delete object; }
+  };
+
   /**
  * @brief Clase TUniquePtr para manejo exclusivo de memoria.
  *
  * La clase TUniquePtr gestiona la memoria de un objeto de tipo T y garantiza
  * que solo una instancia de TUniquePtr puede poseer y gestionar el objeto en
  * cualquier momento.
+ *
+ * @tparam Deleter Borrador sin estado que libera el objeto (por ejemplo, TPoolDelete
+ * para devolverlo a su TObjectPool).
  */
-  template<typename T>
+  template<typename T, typename Deleter = TDefaultDelete<T>>
   class TUniquePtr
   {
   public:
@@ -61,7 +73,7 @@ namespace EngineUtilities {
      *
      * @param other Otro objeto TUniquePtr del mismo tipo T.
      */
-    TUniquePtr(TUniquePtr<T>&& other) noexcept : ptr(other.ptr)
+    TUniquePtr(TUniquePtr&& other) noexcept : ptr(other.ptr)
     {
       other.ptr = nullptr;
     }
@@ -75,12 +87,12 @@ namespace EngineUtilities {
      * @param other Otro objeto TUniquePtr del mismo tipo T.
      * @return Referencia al objeto TUniquePtr actual.
      */
-    TUniquePtr<T>& operator=(TUniquePtr<T>&& other) noexcept
+    TUniquePtr& operator=(TUniquePtr&& other) noexcept
     {
       if (this != &other)
       {
         // Liberar el objeto actual
-        delete ptr;
+        Deleter()(ptr);
 
         // Transferir los datos del otro puntero exclusivo
         ptr = other.ptr;
@@ -96,12 +108,12 @@ namespace EngineUtilities {
      */
     ~TUniquePtr()
     {
-      delete ptr;
+      Deleter()(ptr);
     }
 
     // Prohibir la copia de TUniquePtr
-    TUniquePtr(const TUniquePtr<T>&) = delete;
-    TUniquePtr<T>& operator=(const TUniquePtr<T>&) = delete;
+    TUniquePtr(const TUniquePtr&) = delete;
+    TUniquePtr& operator=(const TUniquePtr&) = delete;
 
     /**
      * @brief Operador de desreferenciacin.
@@ -147,7 +159,7 @@ namespace EngineUtilities {
      */
     void reset(T* rawPtr = nullptr)
     {
-      delete ptr;
+      Deleter()(ptr);
       ptr = rawPtr;
     }
 
@@ -37,44 +37,162 @@ namespace EngineUtilities {
 		 * sin tener influencia sobre el recuento de referencias del objeto. Permite acceder al objeto solo si
 		 * an existe.
 		 */
-	template<typename T>
+	template<typename T, typename RefCountPolicy = SingleThreadRefCount>
 	class TWeakPointer
 	{
 	public:
+		using ControlBlock = TControlBlock<RefCountPolicy>; ///< Tipo del bloque de control.
+
 		/**
 		 * @brief Constructor por defecto.
 		 */
-		TWeakPointer() : ptr(nullptr), refCount(nullptr) {}
+		TWeakPointer() : ptr(nullptr), controlBlock(nullptr) {}
 
 		/**
 		 * @brief Constructor que toma un TSharedPointer.
 		 *
+		 * Solo mantiene vivo el bloque de control, no el objeto.
+		 *
 		 * @param sharedPtr TSharedPointer desde el cual se observar el objeto.
 		 */
-		TWeakPointer(const TSharedPointer<T>& sharedPtr) 
-		: ptr(sharedPtr.ptr), refCount(sharedPtr.refCount) {}
+		TWeakPointer(const TSharedPointer<T, RefCountPolicy>& sharedPtr) 
+		: ptr(sharedPtr.ptr), controlBlock(sharedPtr.controlBlock)
+		{
+			if (controlBlock)
+			{
+				controlBlock->addWeakReference();
+			}
+		}
+
+		/**
+		 * @brief Constructor de copia.
+		 *
+		 * @param other Otro TWeakPointer del mismo tipo T.
+		 */
+		TWeakPointer(const TWeakPointer& other) : ptr(other.ptr), controlBlock(other.controlBlock)
+		{
+			if (controlBlock)
+			{
+				controlBlock->addWeakReference();
+			}
+		}
+
+		/**
+		 * @brief Constructor de movimiento.
+		 *
+		 * @param other Otro TWeakPointer del mismo tipo T.
+		 */
+		TWeakPointer(TWeakPointer&& other) noexcept : ptr(other.ptr), controlBlock(other.controlBlock)
+		{
+			other.ptr = nullptr;
+			other.controlBlock = nullptr;
+		}
+
+		/**
+		 * @brief Operador de asignacin de copia.
+		 *
+		 * @param other Otro TWeakPointer del mismo tipo T.
+		 * @return Referencia al TWeakPointer actual.
+		 */
+		TWeakPointer& operator=(const TWeakPointer& other)
+		{
+			if (this != &other)
+			{
+				if (other.controlBlock)
+				{
+					other.controlBlock->addWeakReference();
+				}
+				if (controlBlock)
+				{
+					controlBlock->releaseWeakReference();
+				}
+				ptr = other.ptr;
+				controlBlock = other.controlBlock;
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Operador de asignacin de movimiento.
+		 *
+		 * @param other Otro TWeakPointer del mismo tipo T.
+		 * @return Referencia al TWeakPointer actual.
+		 */
+		TWeakPointer& operator=(TWeakPointer&& other) noexcept
+		{
+			if (this != &other)
+			{
+				if (controlBlock)
+				{
+					controlBlock->releaseWeakReference();
+				}
+				ptr = other.ptr;
+				controlBlock = other.controlBlock;
+				other.ptr = nullptr;
+				other.controlBlock = nullptr;
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Destructor. Suelta el bloque de control si era el ltimo observador.
+		 */
+		~TWeakPointer()
+		{
+			if (controlBlock)
+			{
+				controlBlock->releaseWeakReference();
+			}
+		}
 
 		/**
 		 * @brief Convertir TWeakPointer a TSharedPointer.
 		 *
+		 * Es seguro aunque el objeto ya haya sido destruido: el bloque de control sigue vivo
+		 * mientras exista este TWeakPointer.
+		 *
 		 * @return Un TSharedPointer al objeto gestionado, o nullptr si el objeto ha sido destruido.
 		 */
-		TSharedPointer<T> lock() const
+		TSharedPointer<T, RefCountPolicy> lock() const
+		{
+			if (controlBlock && controlBlock->tryAddReference())
+			{
+				return TSharedPointer<T, RefCountPolicy>(ptr, controlBlock,
+				                                         typename TSharedPointer<T, RefCountPolicy>::AdoptBlock());
+			}
+			return TSharedPointer<T, RefCountPolicy>();
+		}
+
+		/**
+		 * @brief Comprobar si el objeto observado ya fue destruido.
+		 *
+		 * @return true si no hay objeto o ya no quedan TSharedPointer que lo gestionen.
+		 */
+		bool expired() const
+		{
+			return controlBlock == nullptr || controlBlock->useCount() == 0;
+		}
+
+		/**
+		 * @brief Deja de observar el objeto.
+		 */
+		void reset()
 		{
-			if (refCount && *refCount > 0)
+			if (controlBlock)
 			{
-				return TSharedPointer<T>(ptr, refCount);
+				controlBlock->releaseWeakReference();
 			}
-			return TSharedPointer<T>();
+			ptr = nullptr;
+			controlBlock = nullptr;
 		}
 
 		// Hacer que TSharedPointer sea un amigo para acceder a los miembros privados.
-		template<typename U>
+		template<typename U, typename P>
 		friend class TSharedPointer;
 
 	private:
 		T* ptr;       ///< Puntero al objeto observado.
-		int* refCount; ///< Puntero al recuento de referencias del TSharedPointer original.
+		ControlBlock* controlBlock; ///< Bloque de control del TSharedPointer original.
 	};
 
 	/*
@@ -14,10 +14,17 @@
 #include <map>          ///< Sorted associative container.
 #include <fstream>      ///< File input/output.
 #include <unordered_map>///< Hash table-based associative container.
+#include <array>        ///< Fixed-size array container.
+#include <atomic>       ///< Atomic types for lock-free counters.
+#include <cstdint>      ///< Fixed-width integer types.
+#include <bitset>       ///< Fixed-size bit sets (component signatures).
 
 #include <Memory/TSharedPointer.h>
 #include <Memory/TStaticPtr.h>
 #include <Memory/TUniquePtr.h>
+#include <Memory/TObjectPool.h>
+#include <Utilities/Logger.h>
+#include <Utilities/ErrorReport.h>
 
 
 
@@ -35,35 +42,25 @@
 #define SAFE_PTR_RELEASE(x) if(x != nullptr) { delete x; x = nullptr; }
 
  /**
-  * @brief Logs a resource creation message to standard error.
+  * @brief Logs an informational message through the asynchronous Logger.
   *
-  * @param classObj Name of the class.
-  * @param method Name of the method.
+  * @param classObj Name of the class (string literal).
+  * @param method Name of the method (string literal).
   * @param state Message indicating resource state.
   */
-#define MESSAGE(classObj, method, state)                            \
-{                                                                   \
-    std::ostringstream os_;                                         \
-    os_ << classObj << "::" << method                                \
-        << " : [CREATION OF RESOURCE: " << state << "]\n";         \
-    std::cerr << os_.str();                                         \
-}
+#define MESSAGE(classObj, method, state) LOG_INFO(classObj, method, state)
 
   /**
-   * @brief Logs an error message and terminates the program.
+   * @brief Reports an error through ErrorReport and evaluates to ErrorCode::FAILURE.
    *
-   * @param classObj Name of the class.
-   * @param method Name of the method.
+   * With the ABORT policy (default in debug builds) it logs, flushes and terminates the program
+   * as before; otherwise the caller continues. Prefer REPORT_ERROR with a specific code.
+   *
+   * @param classObj Name of the class (string literal).
+   * @param method Name of the method (string literal).
    * @param errorMSG Description of the error.
    */
-#define ERROR(classObj, method, errorMSG)                           \
-{                                                                   \
-    std::ostringstream os_;                                         \
-    os_ << "ERROR: " << classObj << "::" << method                   \
-        << " : Error in data from params [" << errorMSG << "]\n";   \
-    std::cerr << os_.str();                                         \
-    std::exit(1);                                                   \
-}
+#define ERROR(classObj, method, errorMSG) REPORT_ERROR(ErrorCode::FAILURE, classObj, method, errorMSG)
 
    // === Enumerations ===
 
@@ -0,0 +1,92 @@
+#pragma once
+
+/**
+ * @file SpriteBatch.h
+ * @brief Declares SpriteBatch, which merges many sf::Shape draws into few vertex-array draws.
+ */
+
+#include "../Prerequisites.h"
+#include "../Memory/FrameArena.h"
+
+class
+  Window;
+
+/**
+ * @class SpriteBatch
+ * @brief Collects transformed shape triangles and draws each run of equal texture at once.
+ *
+ * Shapes are turned into world-space triangles on the CPU and appended to one vertex buffer.
+ * Consecutive shapes that use the same texture (or none) form one batch, drawn with a single
+ * call. Submission order is kept, so the painter's order of the scene does not change. Shapes
+ * with an outline cannot be expressed as a fill-only fan and are drawn directly.
+ *
+ * The vertex and batch arrays are TFrameVectors: each begin() starts a fresh pair in the frame
+ * arena, reserved for the largest frame seen so far, so batching does not call malloc once
+ * the arena has grown to fit a frame.
+ */
+class
+  SpriteBatch {
+public:
+  /**
+   * @brief Constructor.
+   * @param frameArena Arena for the per-frame arrays; must outlive the batch.
+   */
+  explicit SpriteBatch(EngineUtilities::FrameArena& frameArena);
+
+  /**
+   * @brief Destructor.
+   */
+  ~SpriteBatch() = default;
+
+  /**
+   * @brief Starts a new frame of batching with arrays sized for the largest frame so far.
+   */
+  void
+    begin();
+
+  /**
+   * @brief Appends a shape to the current batch.
+   * @param shape Shape to draw; its transform, texture rect and fill color are baked in.
+   * @param window Window used to draw directly shapes that cannot be batched.
+   */
+  void
+    add(const sf::Shape& shape, Window& window);
+
+  /**
+   * @brief Draws every pending batch and clears them.
+   * @param window Window to draw into.
+   */
+  void
+    flush(Window& window);
+
+  /**
+   * @brief Returns the number of draw calls issued since begin().
+   */
+  uint32_t
+    getDrawCallCount() const { return m_drawCalls; }
+
+  /**
+   * @brief Returns the number of shapes submitted since begin().
+   */
+  uint32_t
+    getShapeCount() const { return m_shapes; }
+
+private:
+  /**
+   * @struct Batch
+   * @brief Run of vertices that share one texture.
+   */
+  struct
+    Batch {
+    const sf::Texture* texture; ///< Texture of the run (nullptr = untextured).
+    size_t first;               ///< First vertex in m_vertices.
+    size_t count;               ///< Number of vertices.
+  };
+
+  EngineUtilities::TFrameVector<sf::Vertex> m_vertices; ///< Triangles of every pending batch.
+  EngineUtilities::TFrameVector<Batch> m_batches;       ///< Pending batches in submission order.
+  size_t m_vertexReserve = 0;                           ///< Most vertices pending at once so far.
+  size_t m_batchReserve = 0;                            ///< Most batches pending at once so far.
+  uint32_t m_drawCalls = 0;                             ///< Draw calls this frame.
+  uint32_t m_shapes = 0;                                ///< Shapes submitted this frame.
+};
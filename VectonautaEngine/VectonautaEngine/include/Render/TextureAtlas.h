@@ -0,0 +1,148 @@
+#pragma once
+
+/**
+ * @file TextureAtlas.h
+ * @brief Declares TextureAtlas, a skyline packer that merges many images into a few GPU pages.
+ */
+
+#include "../Prerequisites.h"
+
+/**
+ * @struct AtlasPage
+ * @brief One GPU texture of an atlas.
+ *
+ * Shared by every Texture that lives in it, so a page stays alive while any sub-rect is in use.
+ */
+struct
+  AtlasPage {
+  sf::Texture texture; ///< Page pixels on the GPU.
+};
+
+/**
+ * @class TextureAtlas
+ * @brief Packs images into large pages using the skyline bottom-left heuristic.
+ *
+ * Each page keeps its skyline: the top edge of the space already used, as a list of horizontal
+ * segments. A new image goes where its top edge ends lowest, which keeps the pages dense
+ * without the bookkeeping of maxrects. Images larger than a page get a page of their own.
+ * Must be used on the thread that owns the GL context.
+ */
+class
+  TextureAtlas {
+public:
+  /**
+   * @brief Constructor.
+   * @param pageSize Width and height of every regular page, in pixels.
+   * @param padding Empty pixels kept between images to avoid sampling neighbours.
+   */
+  explicit TextureAtlas(uint32_t pageSize = 2048, uint32_t padding = 1);
+
+  /**
+   * @brief Destructor.
+   */
+  ~TextureAtlas() = default;
+
+  TextureAtlas(const TextureAtlas&) = delete;
+  TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+  /**
+   * @brief Copies an image into a page.
+   * @param image Decoded image to pack.
+   * @param outPage Receives the page the image was placed in.
+   * @param outRect Receives the image rectangle inside the page, in pixels.
+   * @return false if the page texture could not be created.
+   */
+  bool
+    insert(const sf::Image& image,
+           EngineUtilities::TSharedPointer<AtlasPage>& outPage,
+           sf::IntRect& outRect);
+
+  /**
+   * @brief Copies raw RGBA pixels into a page (no intermediate sf::Image).
+   * @param pixels width * height RGBA pixels, row by row.
+   * @param width Width in pixels.
+   * @param height Height in pixels.
+   * @param outPage Receives the page the pixels were placed in.
+   * @param outRect Receives the pixels rectangle inside the page.
+   * @return false if the page texture could not be created.
+   */
+  bool
+    insert(const uint8_t* pixels,
+           uint32_t width,
+           uint32_t height,
+           EngineUtilities::TSharedPointer<AtlasPage>& outPage,
+           sf::IntRect& outRect);
+
+  /**
+   * @brief Drops the pages no Texture refers to any more, freeing their GPU memory.
+   *
+   * Space of single images is never reused inside a page; a page goes away as a whole once
+   * all of its images have been released.
+   * @return Number of pages released.
+   */
+  size_t
+    releaseUnusedPages();
+
+  /**
+   * @brief Returns the number of live pages.
+   */
+  size_t
+    getPageCount() const { return m_pages.size(); }
+
+private:
+  /**
+   * @struct SkylineNode
+   * @brief Horizontal segment of a page skyline.
+   */
+  struct
+    SkylineNode {
+    uint32_t x;     ///< Left edge.
+    uint32_t y;     ///< Height already used under the segment.
+    uint32_t width; ///< Segment width.
+  };
+
+  /**
+   * @struct Page
+   * @brief A page and the skyline of its used space.
+   */
+  struct
+    Page {
+    EngineUtilities::TSharedPointer<AtlasPage> page; ///< GPU texture.
+    std::vector<SkylineNode> skyline;                ///< Used space, left to right.
+    uint32_t width = 0;                              ///< Page width.
+    uint32_t height = 0;                             ///< Page height.
+  };
+
+  /**
+   * @brief Creates a page of the given size with an empty skyline.
+   * @return Index of the page, or -1 if the texture could not be created.
+   */
+  int32_t
+    createPage(uint32_t width, uint32_t height);
+
+  /**
+   * @brief Finds the lowest position where a width x height block fits.
+   * @return Index of the skyline node to place at, or -1 if it does not fit.
+   */
+  int32_t
+    findPosition(const Page& page,
+                 uint32_t width,
+                 uint32_t height,
+                 uint32_t& outX,
+                 uint32_t& outY) const;
+
+  /**
+   * @brief Raises the skyline over a newly placed block.
+   */
+  void
+    addSkylineLevel(Page& page,
+                    int32_t nodeIndex,
+                    uint32_t x,
+                    uint32_t y,
+                    uint32_t width,
+                    uint32_t height);
+
+  uint32_t m_pageSize;       ///< Size of regular pages.
+  uint32_t m_padding;        ///< Gap between images.
+  std::vector<Page> m_pages; ///< Pages in creation order.
+};
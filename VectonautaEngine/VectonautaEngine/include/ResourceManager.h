@@ -3,23 +3,254 @@
 #include "Prerequisites.h"
 #include <unordered_map>
 #include "ECS/Texture.h"
+#include "Jobs/JobSystem.h"
+#include "Assets/AssetArchive.h"
+
+/**
+ * @struct TextureLoadState
+ * @brief Estado compartido de una carga asncrona de textura.
+ *
+ * Un hilo de trabajo lee el archivo y decodifica la imagen; el hilo dueo del ResourceManager
+ * hace la subida a la GPU en ResourceManager::update().
+ */
+struct TextureLoadState {
+  /**
+   * @brief Estado visible para quien pidi la textura.
+   */
+  enum class Status {
+    LOADING, ///< Decodificando o esperando la subida a la GPU.
+    READY,   ///< Textura cargada.
+    FAILED   ///< No se pudo leer o decodificar el archivo.
+  };
+
+  std::string key;                       ///< Clave de la textura (fileName).
+  std::string path;                      ///< Ruta del archivo a decodificar.
+  sf::Image image;                       ///< Imagen decodificada por el hilo de trabajo.
+  bool decodeSucceeded = false;          ///< Resultado de la decodificacin.
+  std::atomic<bool> decoded{ false };    ///< La decodificacin termin (publica image y decodeSucceeded).
+  Status status = Status::LOADING;       ///< Estado; solo lo toca el hilo dueo.
+  EngineUtilities::TSharedPointer<Texture> texture; ///< Placeholder hasta que la carga termina.
+};
+
+/**
+ * @class TextureRequest
+ * @brief Handle que se puede consultar cada frame mientras una textura carga en segundo plano.
+ *
+ * Varias peticiones de la misma clave comparten el mismo estado. Mientras la carga no termina,
+ * getTexture() devuelve la textura "Default".
+ */
+class TextureRequest {
+public:
+  TextureRequest() = default;
+
+  /**
+   * @brief Devuelve el estado de la carga.
+   */
+  TextureLoadState::Status getStatus() const {
+    return m_state.isNull() ? TextureLoadState::Status::FAILED : m_state->status;
+  }
+
+  /**
+   * @brief true si la textura ya est cargada.
+   */
+  bool isReady() const { return getStatus() == TextureLoadState::Status::READY; }
+
+  /**
+   * @brief true si la carga termin, con xito o no.
+   */
+  bool isDone() const { return getStatus() != TextureLoadState::Status::LOADING; }
+
+  /**
+   * @brief Devuelve la textura cargada, o el placeholder si todava no est lista o fall.
+   */
+  EngineUtilities::TSharedPointer<Texture> getTexture() const {
+    return m_state.isNull() ? EngineUtilities::TSharedPointer<Texture>() : m_state->texture;
+  }
+
+private:
+  friend class ResourceManager;
+
+  explicit TextureRequest(const EngineUtilities::TSharedPointer<TextureLoadState>& state)
+    : m_state(state) {}
+
+  EngineUtilities::TSharedPointer<TextureLoadState> m_state; ///< Estado compartido de la carga.
+};
+
+/**
+ * @struct TextureCacheStats
+ * @brief Contadores de la cach de texturas del ResourceManager.
+ */
+struct TextureCacheStats {
+  uint64_t hits = 0;        ///< getTexture() encontr la textura residente.
+  uint64_t misses = 0;      ///< getTexture() tuvo que recargarla, esperarla o no la encontr.
+  uint64_t evictions = 0;   ///< Texturas expulsadas para respetar el presupuesto.
+  size_t residentBytes = 0; ///< Bytes de GPU (RGBA) de las pginas residentes, completas.
+  size_t residentPages = 0; ///< Pginas residentes (del atlas o propias).
+};
 
 class ResourceManager {
 public:
+  ResourceManager() = default;
+
+  /**
+   * @brief Espera a que terminen las decodificaciones en curso.
+   */
+  ~ResourceManager();
+
+  ResourceManager(const ResourceManager&) = delete;
+  ResourceManager& operator=(const ResourceManager&) = delete;
+
+  /**
+   * @brief Asigna el sistema de jobs que decodifica las texturas asncronas.
+   * @param jobSystem Sistema de jobs, o nullptr para decodificar en el hilo que llama.
+   */
+  void setJobSystem(JobSystem* jobSystem) { m_jobSystem = jobSystem; }
+
+  /**
+   * @brief Fija el presupuesto de memoria de las texturas residentes.
+   *
+   * La memoria se cuenta y se libera por pginas: una pgina del atlas ocupa lo mismo en la GPU
+   * tenga una imagen o cien. Cuando se supera el presupuesto se expulsan pginas enteras, de la
+   * usada hace ms tiempo a la ms reciente, si ninguna de sus texturas tiene usuarios (ningn
+   * TSharedPointer<Texture> vivo fuera del ResourceManager). Una textura expulsada se vuelve a
+   * cargar sola en el siguiente getTexture().
+   * @param bytes Presupuesto en bytes, o 0 para no limitar.
+   */
+  void setMemoryBudget(size_t bytes);
+
+  /**
+   * @brief Monta un archivo de assets empaquetado (ver AssetArchive).
+   *
+   * Las texturas que estn en el archivo se suben a la GPU directamente desde el mapeo, sin
+   * decodificar PNG; las que no estn se siguen cargando desde archivos sueltos.
+   * @param path Ruta del archivo.
+   * @return false si no existe o no es vlido (se siguen usando archivos sueltos).
+   */
+  bool mountArchive(const std::string& path);
+
+  /**
+   * @brief Devuelve los contadores de la cach.
+   */
+  const TextureCacheStats& getStats() const { return m_stats; }
+
   /**
    * @brief Carga una textura y la almacena bajo la clave fileName.
+   *
+   * Si la clave ya se est cargando con loadTextureAsync() no se espera: devuelve LOADING y la
+   * textura queda lista en un update() posterior. Quien necesite seguir esa carga debe usar el
+   * TextureRequest de loadTextureAsync().
+   * @param fileName Nombre base del archivo (sin extensin).
+   * @param extension Extensin del archivo (por defecto "png").
+   * @return READY si la textura ya era residente o se carg, LOADING si est pendiente de una
+   *         carga asncrona, FAILED si no se pudo leer.
+   */
+  TextureLoadState::Status loadTexture(const std::string& fileName, const std::string& extension = "png");
+
+  /**
+   * @brief Empieza a cargar una textura en segundo plano.
+   *
+   * La lectura y decodificacin del archivo se hacen en el sistema de jobs; la subida a la GPU
+   * ocurre en update(). Si la clave ya est cargada o cargando, se devuelve el mismo estado.
    * @param fileName Nombre base del archivo (sin extensin).
    * @param extension Extensin del archivo (por defecto "png").
-   * @return true si la textura ya exista o se carg correctamente.
+   * @return Handle para consultar la carga.
    */
-  bool loadTexture(const std::string& fileName, const std::string& extension = "png");
+  TextureRequest loadTextureAsync(const std::string& fileName, const std::string& extension = "png");
+
+  /**
+   * @brief Sube a la GPU las imgenes ya decodificadas y aplica el presupuesto de memoria.
+   *
+   * Llamar una vez por frame en el hilo dueo.
+   */
+  void update();
 
   /**
    * @brief Devuelve la textura cargada con fileName, o la textura por defecto si no existe.
+   *
+   * La textura es un sub-rect de una pgina del atlas: ver Texture::getTextureRect().
    */
   EngineUtilities::TSharedPointer<Texture> getTexture(const std::string& fileName);
 
 private:
-  // Mapa de texturas cargadas: clave = fileName, valor = puntero compartido a Texture
-  std::unordered_map<std::string, EngineUtilities::TSharedPointer<Texture>> m_textures;
-};
+  /**
+   * @brief Devuelve la textura "Default", cargndola la primera vez.
+   */
+  EngineUtilities::TSharedPointer<Texture> getDefaultTexture();
+
+  /**
+   * @brief Empaqueta pxeles RGBA en el atlas y crea la textura que apunta a su zona.
+   * @param shared false para darle una pgina propia (texturas que nunca se expulsan).
+   */
+  EngineUtilities::TSharedPointer<Texture> createTexture(const uint8_t* pixels,
+                                                         uint32_t width,
+                                                         uint32_t height,
+                                                         bool shared);
+
+  /**
+   * @brief Crea la textura, la registra como residente y aplica el presupuesto.
+   *
+   * Si la clave ya es residente devuelve esa textura sin volver a empaquetarla.
+   * @param key Clave de la textura.
+   * @param path Ruta del archivo, para poder recargarla tras expulsarla.
+   * @param pixels Pxeles RGBA (imagen decodificada o mapeo del archivo de assets).
+   * @param width Ancho en pxeles.
+   * @param height Alto en pxeles.
+   */
+  EngineUtilities::TSharedPointer<Texture> insertTexture(const std::string& key,
+                                                         const std::string& path,
+                                                         const uint8_t* pixels,
+                                                         uint32_t width,
+                                                         uint32_t height);
+
+  /**
+   * @brief Carga una textura de forma sncrona: del archivo de assets si la contiene, si no del disco.
+   * @return La textura, o un puntero nulo si no se pudo leer.
+   */
+  EngineUtilities::TSharedPointer<Texture> loadFromSource(const std::string& key, const std::string& path);
+
+  /**
+   * @brief Expulsa pginas sin usuarios, de la menos a la ms reciente, hasta cumplir el presupuesto.
+   */
+  void enforceBudget();
+
+  /**
+   * @brief Expulsa todas las texturas de una pgina y descuenta la pgina.
+   */
+  void evictPage(const AtlasPage* page);
+
+  /**
+   * @struct TextureEntry
+   * @brief Textura residente y su contabilidad.
+   */
+  struct TextureEntry {
+    EngineUtilities::TSharedPointer<Texture> texture; ///< Textura compartida.
+    std::string path;                                 ///< Archivo del que se carg.
+    uint64_t lastUse = 0;                             ///< Valor de m_useClock en el ltimo uso.
+  };
+
+  /**
+   * @struct PageEntry
+   * @brief Pgina residente: la unidad en que se cuenta y se libera la memoria.
+   */
+  struct PageEntry {
+    std::vector<std::string> keys; ///< Texturas que viven en la pgina.
+    size_t bytes = 0;              ///< Bytes de GPU de la pgina completa.
+    bool pinned = false;           ///< Nunca se expulsa (textura "Default").
+  };
+
+  // Mapa de texturas cargadas: clave = fileName, valor = textura y su contabilidad
+  std::unordered_map<std::string, TextureEntry> m_textures;
+  // Pginas residentes y las texturas de cada una
+  std::unordered_map<const AtlasPage*, PageEntry> m_pages;
+  uint64_t m_useClock = 0;          ///< Contador de usos para el orden LRU.
+  // Texturas expulsadas: clave -> ruta para recargarlas en getTexture()
+  std::unordered_map<std::string, std::string> m_evicted;
+  size_t m_memoryBudget = 0;        ///< Presupuesto en bytes (0 = sin lmite).
+  TextureCacheStats m_stats;        ///< Aciertos, fallos, expulsiones y bytes residentes.
+  // Cargas asncronas en curso: clave = fileName
+  std::unordered_map<std::string, EngineUtilities::TSharedPointer<TextureLoadState>> m_pending;
+  TextureAtlas m_atlas;             ///< Pginas donde viven todas las texturas cargadas.
+  AssetArchive m_archive;           ///< Archivo de assets montado (puede estar cerrado).
+  JobSystem* m_jobSystem = nullptr; ///< Sistema de jobs para decodificar (puede ser nullptr).
+  JobCounter m_loadCounter;         ///< Decodificaciones en vuelo.
+};
\ No newline at end of file
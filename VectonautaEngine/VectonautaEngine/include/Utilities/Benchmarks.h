@@ -0,0 +1,79 @@
+#pragma once
+
+/**
+ * @file Benchmarks.h
+ * @brief Declares the micro-benchmarks selected with --bench.
+ */
+
+#include "../Prerequisites.h"
+
+/**
+ * @class Benchmarks
+ * @brief Times engine building blocks in isolation and prints one report per benchmark.
+ *
+ * Each benchmark runs the current code path next to the one it replaced (or next to its
+ * alternatives) on the same data, so the report shows the speedup directly. Run it with
+ * `--bench NAME [SIZE]`; SIZE of 0 uses the benchmark's default.
+ */
+class
+  Benchmarks {
+public:
+  /**
+   * @brief Runs a benchmark and prints its report.
+   * @param name Benchmark name (see getNames()).
+   * @param size Problem size, such as the number of actors (0 = default).
+   * @return false if the name is unknown or a check failed.
+   */
+  static bool
+    run(const std::string& name, uint32_t size);
+
+  /**
+   * @brief Returns the names accepted by run(), separated by spaces.
+   */
+  static const char*
+    getNames();
+
+private:
+  /**
+   * @brief Component lookup: typed slot index against the old dynamic_cast scan.
+   * @param actors Number of actors (default 10000).
+   */
+  static bool
+    components(uint32_t actors);
+
+  /**
+   * @brief TSharedPointer copy and destroy cost with the plain and the atomic count.
+   * @param pointers Number of distinct objects (default 100000).
+   */
+  static bool
+    refCount(uint32_t pointers);
+
+  /**
+   * @brief Draw calls and frame time of one draw per shape against SpriteBatch.
+   * @param shapes Number of shapes per frame (default 10000).
+   */
+  static bool
+    batch(uint32_t shapes);
+
+  /**
+   * @brief Texture binds and draw calls with one texture per image against the atlas pages.
+   * @param shapes Number of textured shapes per frame (default 10000).
+   */
+  static bool
+    atlas(uint32_t shapes);
+
+  /**
+   * @brief Seek kernels (scalar, SSE, AVX) and SeekSystem on SeekTarget agents.
+   *
+   * Fails if any path does not give bit-identical positions to the scalar one.
+   * @param agents Number of agents (default: 1k, 10k, 100k and 1M in turn).
+   */
+  static bool
+    seek(uint32_t agents);
+
+  /**
+   * @brief Runs seek() for one number of agents.
+   */
+  static bool
+    seekAgents(uint32_t agents);
+};
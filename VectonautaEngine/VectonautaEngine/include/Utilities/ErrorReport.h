@@ -0,0 +1,118 @@
+#pragma once
+
+/**
+ * @file ErrorReport.h
+ * @brief Declares error codes, the error policy and the cold-path reporting helpers.
+ */
+
+#include <cstdint>
+#include <string>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define VECTONAUTA_LIKELY(x) (__builtin_expect(!!(x), 1))
+#define VECTONAUTA_COLD __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define VECTONAUTA_LIKELY(x) (x)
+#define VECTONAUTA_COLD __declspec(noinline)
+#else
+#define VECTONAUTA_LIKELY(x) (x)
+#define VECTONAUTA_COLD
+#endif
+
+/**
+ * @enum ErrorCode
+ * @brief Why an operation failed.
+ */
+enum class
+  ErrorCode : uint8_t {
+  OK = 0,               ///< No error.
+  NOT_INITIALIZED = 1,  ///< The object was used before it was set up (null shape or window).
+  INVALID_ARGUMENT = 2, ///< A parameter is out of range or unknown.
+  RESOURCE_FAILURE = 3, ///< A window, file or GPU resource could not be created.
+  FAILURE = 4,          ///< Any other failure.
+  COUNT = 5             ///< Number of codes.
+};
+
+/**
+ * @enum ErrorPolicy
+ * @brief What ErrorReport::report does besides counting.
+ */
+enum class
+  ErrorPolicy : uint8_t {
+  ABORT = 0,            ///< Log as FATAL, flush the log and exit (the old ERROR behaviour).
+  LOG_AND_CONTINUE = 1, ///< Log and return the code to the caller.
+  COUNT_ONLY = 2        ///< Only count; for hot loops where logging every failure is too much.
+};
+
+/**
+ * @class ErrorReport
+ * @brief Counts errors by code and handles them according to a process-wide policy.
+ *
+ * report() is kept out of line and marked cold, so a hot function only pays for a predictable
+ * branch and a call it never takes. Literal messages go through the const char* overload, so
+ * the call site does not build a std::string either. Callers write the success path first
+ * with VECTONAUTA_LIKELY and report on the other side. The default policy is ABORT in debug
+ * builds and LOG_AND_CONTINUE with NDEBUG.
+ */
+class
+  ErrorReport {
+public:
+  /**
+   * @brief Counts an error and applies the policy.
+   * @param code Error code (not OK).
+   * @param classObj Class name; must be a string literal.
+   * @param method Method name; must be a string literal.
+   * @param message Description of the error.
+   * @return code, so callers can write `return REPORT_ERROR(...)`.
+   */
+  VECTONAUTA_COLD static ErrorCode
+    report(ErrorCode code, const char* classObj, const char* method, const char* message);
+
+  /**
+   * @brief Same as above for a message built at run time.
+   */
+  VECTONAUTA_COLD static ErrorCode
+    report(ErrorCode code, const char* classObj, const char* method, const std::string& message);
+
+  /**
+   * @brief Sets the policy used by report().
+   */
+  static void
+    setPolicy(ErrorPolicy policy);
+
+  /**
+   * @brief Returns the policy used by report().
+   */
+  static ErrorPolicy
+    getPolicy();
+
+  /**
+   * @brief Returns how many errors were reported, over all codes.
+   */
+  static uint64_t
+    getCount();
+
+  /**
+   * @brief Returns how many errors were reported with a code.
+   */
+  static uint64_t
+    getCount(ErrorCode code);
+
+  /**
+   * @brief Sets every counter back to zero.
+   */
+  static void
+    resetCounts();
+
+  /**
+   * @brief Returns the name of a code, for messages.
+   */
+  static const char*
+    getName(ErrorCode code);
+};
+
+/**
+ * @brief Reports an error and evaluates to its code. classObj and method must be literals.
+ */
+#define REPORT_ERROR(code, classObj, method, message) \
+  ErrorReport::report(code, "" classObj, "" method, message)
@@ -0,0 +1,150 @@
+#pragma once
+
+/**
+ * @file Logger.h
+ * @brief Declares the asynchronous logger behind the MESSAGE / ERROR macros.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Lowest level that is compiled in (0 = TRACE ... 4 = FATAL).
+ *
+ * Calls below it expand to nothing. Defaults to TRACE in debug builds and INFO in release.
+ */
+#ifndef VECTONAUTA_LOG_LEVEL
+#if defined(NDEBUG)
+#define VECTONAUTA_LOG_LEVEL 1
+#else
+#define VECTONAUTA_LOG_LEVEL 0
+#endif
+#endif
+
+/**
+ * @enum LogLevel
+ * @brief Severity of a log record.
+ */
+enum class
+  LogLevel : uint8_t {
+  TRACE = 0,   ///< Detailed diagnostics, usually compiled out.
+  INFO = 1,    ///< Normal events (resources created, files loaded).
+  WARNING = 2, ///< Suspicious but harmless situations.
+  FAILURE = 3, ///< Errors the program recovers from (see ErrorReport).
+  FATAL = 4    ///< Unrecoverable errors; flushed before the program exits.
+};
+
+/**
+ * @brief Tells whether records of a level are compiled in (level >= VECTONAUTA_LOG_LEVEL).
+ *
+ * Compares LogLevel values instead of ints, so LOG_AT does not trip -Wtype-limits when the
+ * threshold is 0 and every level passes.
+ */
+constexpr bool
+logLevelEnabled(LogLevel level) {
+  return level >= static_cast<LogLevel>(VECTONAUTA_LOG_LEVEL);
+}
+
+/**
+ * @class Logger
+ * @brief Structured logger that formats and writes on a background thread.
+ *
+ * A record holds a timestamp, a level and three fields: class, method and state. The class and
+ * method are string literals and only their pointers are stored. The state is stored as a
+ * pointer when LOG_AT sees it written as a literal and copied (truncated to a fixed size)
+ * otherwise, char arrays included, since an array may be a stack buffer. Each thread
+ * pushes records into its own lock-free single-producer ring. A flush thread drains the
+ * rings a few times per frame, merges them by timestamp, formats them, and writes them to
+ * std::cerr in a single write. So logging from the frame loop costs a clock read and a copy,
+ * not a syscall. When a ring is full the record is dropped and counted, so the caller never
+ * waits.
+ */
+class
+  Logger {
+public:
+  /**
+   * @brief Characters of a non-literal state kept per record.
+   */
+  static constexpr size_t STATE_CHARS = 88;
+
+  /**
+   * @brief Logs a record whose state is a char array.
+   *
+   * The array is copied unless literal is true. Only LOG_AT passes true, and only when the
+   * argument is spelled as a string literal, so a stack buffer never outlives its scope in a
+   * record.
+   * @param literal true if state is a string literal (stored by pointer).
+   */
+  template<size_t N>
+  static void
+    log(LogLevel level,
+        const char* classObj,
+        const char* method,
+        const char (&state)[N],
+        bool literal = false) {
+    if (literal) {
+      push(level, classObj, method, state, nullptr, 0);
+      return;
+    }
+    const size_t length = static_cast<size_t>(std::find(state, state + N, '\0') - state);
+    push(level, classObj, method, nullptr, state, length);
+  }
+
+  /**
+   * @brief Logs a record whose state is built at run time (copied into the record).
+   */
+  static void
+    log(LogLevel level,
+        const char* classObj,
+        const char* method,
+        const std::string& state,
+        bool /*literal*/ = false) {
+    push(level, classObj, method, nullptr, state.data(), state.size());
+  }
+
+  /**
+   * @brief Writes every pending record and returns once they are written.
+   */
+  static void
+    flush();
+
+  /**
+   * @brief Returns how many records were dropped because a thread ring was full.
+   */
+  static uint64_t
+    getDroppedCount();
+
+private:
+  /**
+   * @brief Stores a record in the calling thread's ring.
+   * @param literal State when it is a literal, else nullptr.
+   * @param text State to copy when literal is nullptr.
+   * @param length Characters in text.
+   */
+  static void
+    push(LogLevel level,
+         const char* classObj,
+         const char* method,
+         const char* literal,
+         const char* text,
+         size_t length);
+};
+
+/**
+ * @brief Logs a record if its level is compiled in. classObj and method must be literals.
+ *
+ * #state starts with a quote only when the argument is written as a string literal; any other
+ * state, char array variables included, is copied into the record.
+ */
+#define LOG_AT(level, classObj, method, state)                                      \
+  do {                                                                              \
+    if constexpr (logLevelEnabled(level)) {                                         \
+      Logger::log(level, "" classObj, "" method, state, (#state)[0] == '"');        \
+    }                                                                               \
+  } while (false)
+
+#define LOG_TRACE(classObj, method, state) LOG_AT(LogLevel::TRACE, classObj, method, state)
+#define LOG_INFO(classObj, method, state) LOG_AT(LogLevel::INFO, classObj, method, state)
+#define LOG_WARNING(classObj, method, state) LOG_AT(LogLevel::WARNING, classObj, method, state)
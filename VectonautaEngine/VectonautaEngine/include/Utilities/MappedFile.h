@@ -0,0 +1,72 @@
+#pragma once
+
+/**
+ * @file MappedFile.h
+ * @brief Declares MappedFile, a read-only memory mapping of a whole file.
+ */
+
+#include "../Prerequisites.h"
+
+/**
+ * @class MappedFile
+ * @brief Maps a file into the address space read-only (MapViewOfFile on Windows, mmap elsewhere).
+ *
+ * The bytes are paged in by the OS on first touch, so opening a large file costs no read and
+ * no copy. The mapping stays valid until close() or destruction.
+ */
+class
+  MappedFile {
+public:
+  /**
+   * @brief Default constructor. Maps nothing.
+   */
+  MappedFile() = default;
+
+  /**
+   * @brief Destructor. Unmaps the file.
+   */
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * @brief Maps a file, unmapping any previous one.
+   * @param path File to map.
+   * @return false if the file cannot be opened or is empty.
+   */
+  bool
+    open(const std::string& path);
+
+  /**
+   * @brief Unmaps the file.
+   */
+  void
+    close();
+
+  /**
+   * @brief Checks whether a file is mapped.
+   */
+  bool
+    isOpen() const { return m_data != nullptr; }
+
+  /**
+   * @brief Returns the first byte of the mapping.
+   */
+  const uint8_t*
+    data() const { return m_data; }
+
+  /**
+   * @brief Returns the size of the mapping in bytes.
+   */
+  size_t
+    size() const { return m_size; }
+
+private:
+  const uint8_t* m_data = nullptr; ///< Start of the mapping.
+  size_t m_size = 0;               ///< Mapped bytes.
+#ifdef _WIN32
+  void* m_fileHandle = nullptr;    ///< HANDLE of the open file.
+  void* m_mappingHandle = nullptr; ///< HANDLE of the file mapping object.
+#endif
+};
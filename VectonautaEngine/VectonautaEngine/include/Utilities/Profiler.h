@@ -0,0 +1,152 @@
+#pragma once
+
+/**
+ * @file Profiler.h
+ * @brief Declares the frame profiler: scoped zones, per-thread event buffers and trace export.
+ */
+
+#include "../Prerequisites.h"
+
+/**
+ * @struct ProfileEvent
+ * @brief One finished zone.
+ */
+struct
+  ProfileEvent {
+  const char* name;    ///< Zone name; must outlive the capture (string literal or long-lived string).
+  uint64_t startNs;    ///< Start time from Profiler::now().
+  uint64_t durationNs; ///< Time spent in the zone.
+};
+
+/**
+ * @class Profiler
+ * @brief Records timed zones from any thread and writes them as a Chrome trace.
+ *
+ * Each thread owns a fixed-size event buffer. Recording writes into that buffer and publishes
+ * the new count with a release store, so zones never take a lock. A lock is only taken once per
+ * thread, to register its buffer. When a buffer is full, further events are dropped and counted.
+ *
+ * Zones are normally placed with the PROFILE_ZONE / PROFILE_FUNCTION macros. These compile
+ * to nothing unless VECTONAUTA_PROFILE is defined (set in the Debug configurations; add it to
+ * Release for production captures).
+ */
+class
+  Profiler {
+public:
+  /**
+   * @brief Returns a monotonic timestamp in nanoseconds.
+   */
+  static uint64_t
+    now();
+
+  /**
+   * @brief Starts a capture. Events of the previous capture are discarded.
+   */
+  static void
+    start();
+
+  /**
+   * @brief Stops recording; zones that end afterwards are ignored.
+   */
+  static void
+    stop();
+
+  /**
+   * @brief Checks whether a capture is running.
+   */
+  static bool
+    isRecording();
+
+  /**
+   * @brief Stores a finished zone in the calling thread's buffer.
+   */
+  static void
+    record(const char* name, uint64_t startNs, uint64_t endNs);
+
+  /**
+   * @brief Names the calling thread in exported traces.
+   */
+  static void
+    setThreadName(const std::string& name);
+
+  /**
+   * @brief Writes the current capture in Chrome trace_event JSON (chrome://tracing, Perfetto).
+   *
+   * Call after stop(), once the other threads have finished their zones.
+   * @param path Output file.
+   * @return false if the file could not be written.
+   */
+  static bool
+    writeChromeTrace(const std::string& path);
+
+  /**
+   * @brief Returns how many events were dropped because a thread buffer was full.
+   */
+  static uint64_t
+    getDroppedCount();
+};
+
+/**
+ * @class ProfileZone
+ * @brief Records the time between its construction and destruction as one event.
+ */
+class
+  ProfileZone {
+public:
+  /**
+   * @brief Starts the zone if a capture is running.
+   * @param name Zone name; must outlive the capture.
+   */
+  explicit ProfileZone(const char* name)
+    : m_name(name),
+    m_active(Profiler::isRecording()),
+    m_start(m_active ? Profiler::now() : 0) {
+  }
+
+  /**
+   * @brief Ends the zone.
+   */
+  ~ProfileZone() {
+    if (m_active) {
+      Profiler::record(m_name, m_start, Profiler::now());
+    }
+  }
+
+  ProfileZone(const ProfileZone&) = delete;
+  ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+  const char* m_name; ///< Zone name.
+  bool m_active;      ///< Whether a capture was running at construction.
+  uint64_t m_start;   ///< Start timestamp.
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if defined(VECTONAUTA_PROFILE)
+/**
+ * @brief Whether zones are compiled in.
+ */
+constexpr bool PROFILER_ENABLED = true;
+
+/**
+ * @brief Times the rest of the enclosing scope under a name.
+ */
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone_, __LINE__)(name)
+
+/**
+ * @brief Times the rest of the enclosing function under its name.
+ */
+#define PROFILE_FUNCTION() PROFILE_ZONE(__FUNCTION__)
+
+/**
+ * @brief Names the calling thread in traces.
+ */
+#define PROFILE_THREAD(name) Profiler::setThreadName(name)
+#else
+constexpr bool PROFILER_ENABLED = false;
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+#define PROFILE_THREAD(name) ((void)0)
+#endif
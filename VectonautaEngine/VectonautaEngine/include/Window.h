@@ -32,6 +32,20 @@ public:
    */
   Window(int width, int height, const std::string& title);
 
+  /**
+   * @brief Constructs a window that can render off-screen.
+   *
+   * A headless window renders into an sf::RenderTexture, has no frame limit and never receives
+   * events, so it works on machines without a display. If no GL context can be created, draws
+   * are skipped and only the CPU side of rendering (vertex generation) runs.
+   *
+   * @param width Width of the render target in pixels.
+   * @param height Height of the render target in pixels.
+   * @param title Title of the window (unused when headless).
+   * @param headless true to render off-screen.
+   */
+  Window(int width, int height, const std::string& title, bool headless);
+
   /**
    * @brief Destructor. Releases any allocated resources.
    */
@@ -45,6 +59,18 @@ public:
   void
     handleEvents();
 
+  /**
+   * @brief Closes the window (or stops a headless window).
+   */
+  void
+    close();
+
+  /**
+   * @brief Checks if the window renders off-screen.
+   */
+  bool
+    isHeadless() const { return m_headless; }
+
   /**
    * @brief Checks if the window is currently open.
    *
@@ -71,6 +97,20 @@ public:
     draw(const sf::Drawable& drawable,
          const sf::RenderStates& states = sf::RenderStates::Default);
 
+  /**
+   * @brief Draws a raw vertex range in a single draw call.
+   *
+   * @param vertices Pointer to the first vertex.
+   * @param vertexCount Number of vertices to draw.
+   * @param type Primitive type the vertices form.
+   * @param states Optional render states (texture, transform...).
+   */
+  void
+    draw(const sf::Vertex* vertices,
+         size_t vertexCount,
+         sf::PrimitiveType type,
+         const sf::RenderStates& states = sf::RenderStates::Default);
+
   /**
    * @brief Displays the contents of the window.
    *
@@ -92,6 +132,10 @@ public:
 
 private:
   EngineUtilities::TUniquePtr<sf::RenderWindow> m_windowPtr; ///< Unique pointer to the SFML render window.
+  EngineUtilities::TUniquePtr<sf::RenderTexture> m_texturePtr; ///< Off-screen target in headless mode.
+  sf::RenderTarget* m_target = nullptr; ///< Target all draws go to (window or texture).
+  bool m_headless = false;              ///< Renders off-screen without a frame limit.
+  bool m_headlessOpen = false;          ///< Open state of a headless window.
   sf::View m_view; ///< View used for rendering (not currently exposed).
 public:
   sf::Time deltaTime;
@@ -0,0 +1,210 @@
+#include "Assets/AssetArchive.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+/**
+ * @file AssetArchive.cpp
+ * @brief Implements reading and packing of asset archives.
+ */
+
+namespace {
+  /**
+   * @brief Rounds an offset up to the next multiple of 16.
+   */
+  uint64_t
+  alignTo16(uint64_t offset) {
+    return (offset + 15) & ~uint64_t(15);
+  }
+
+  /**
+   * @brief Checks that [offset, offset + length) lies inside a file of size bytes, without overflow.
+   */
+  bool
+  fitsIn(uint64_t offset, uint64_t length, uint64_t size) {
+    return offset <= size && length <= size - offset;
+  }
+
+  /**
+   * @brief Returns the archive key of a file: its path relative to root, with '/' separators
+   *        and no extension.
+   * @return Empty if the file is not inside root.
+   */
+  std::string
+  keyFromPath(const std::string& path, const std::string& root) {
+    namespace fs = std::filesystem;
+    fs::path relative = fs::absolute(path).lexically_normal()
+      .lexically_relative(fs::absolute(root).lexically_normal());
+    if (relative.empty() || *relative.begin() == "..") {
+      return std::string();
+    }
+    return relative.replace_extension().generic_string();
+  }
+}
+
+bool
+AssetArchive::open(const std::string& path) {
+  close();
+  if (!m_file.open(path)) {
+    return false;
+  }
+
+  // Validamos todo una vez; findTexture() ya no comprueba limites
+  const uint8_t* data = m_file.data();
+  const size_t size = m_file.size();
+  Header header;
+  if (size < sizeof(Header)) {
+    close();
+    return false;
+  }
+  std::memcpy(&header, data, sizeof(Header));
+  if (header.magic != MAGIC || header.version != VERSION ||
+      header.entryCount > (size - sizeof(Header)) / sizeof(TocEntry)) {
+    std::cerr << "[AssetArchive] Invalid archive: " << path << "\n";
+    close();
+    return false;
+  }
+
+  const TocEntry* toc = reinterpret_cast<const TocEntry*>(data + sizeof(Header));
+  for (uint32_t i = 0; i < header.entryCount; ++i) {
+    const TocEntry& entry = toc[i];
+    // width * height cabe en 64 bits; por 4 podria desbordar, por eso se compara con size / 4
+    const uint64_t pixelCount = uint64_t(entry.width) * entry.height;
+    if (!fitsIn(entry.nameOffset, entry.nameLength, size) ||
+        pixelCount > size / 4 ||
+        !fitsIn(entry.dataOffset, pixelCount * 4, size) ||
+        (i > 0 && toc[i - 1].hash > entry.hash)) {
+      std::cerr << "[AssetArchive] Corrupt table of contents: " << path << "\n";
+      close();
+      return false;
+    }
+  }
+
+  m_toc = toc;
+  m_entryCount = header.entryCount;
+  return true;
+}
+
+void
+AssetArchive::close() {
+  m_file.close();
+  m_toc = nullptr;
+  m_entryCount = 0;
+}
+
+bool
+AssetArchive::findTexture(const std::string& key, TextureView& out) const {
+  if (m_toc == nullptr) {
+    return false;
+  }
+
+  const uint64_t hash = hashKey(key);
+  const TocEntry* end = m_toc + m_entryCount;
+  const TocEntry* entry = std::lower_bound(m_toc, end, hash,
+    [](const TocEntry& lhs, uint64_t value) { return lhs.hash < value; });
+
+  // Colisiones de hash: se comparan los nombres
+  for (; entry != end && entry->hash == hash; ++entry) {
+    const char* name = reinterpret_cast<const char*>(m_file.data() + entry->nameOffset);
+    if (entry->nameLength == key.size() &&
+        std::memcmp(name, key.data(), key.size()) == 0) {
+      out.pixels = m_file.data() + entry->dataOffset;
+      out.width = entry->width;
+      out.height = entry->height;
+      return true;
+    }
+  }
+  return false;
+}
+
+uint64_t
+AssetArchive::hashKey(const std::string& key) {
+  uint64_t hash = 14695981039346656037ull;
+  for (unsigned char c : key) {
+    hash ^= c;
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+bool
+AssetArchive::pack(const std::vector<std::string>& files,
+                   const std::string& root,
+                   const std::string& outputPath) {
+  struct Asset {
+    std::string key;
+    sf::Image image;
+  };
+
+  // 1) Decodificamos todo; claves repetidas se ignoran
+  std::vector<Asset> assets;
+  assets.reserve(files.size());
+  for (const std::string& file : files) {
+    Asset asset;
+    asset.key = keyFromPath(file, root);
+    if (asset.key.empty()) {
+      std::cerr << "[AssetArchive] Not inside " << root << ": " << file << "\n";
+      return false;
+    }
+    const bool duplicate = std::any_of(assets.begin(), assets.end(),
+      [&asset](const Asset& other) { return other.key == asset.key; });
+    if (duplicate) {
+      std::cerr << "[AssetArchive] Skipping duplicate key: " << asset.key << "\n";
+      continue;
+    }
+    if (!asset.image.loadFromFile(file)) {
+      std::cerr << "[AssetArchive] Cannot decode: " << file << "\n";
+      return false;
+    }
+    assets.push_back(std::move(asset));
+  }
+  std::sort(assets.begin(), assets.end(), [](const Asset& lhs, const Asset& rhs) {
+    return hashKey(lhs.key) < hashKey(rhs.key);
+  });
+
+  // 2) Calculamos la tabla de contenidos
+  const uint32_t count = static_cast<uint32_t>(assets.size());
+  std::vector<TocEntry> toc(count);
+  uint64_t offset = sizeof(Header) + uint64_t(count) * sizeof(TocEntry);
+  for (uint32_t i = 0; i < count; ++i) {
+    toc[i].hash = hashKey(assets[i].key);
+    toc[i].nameOffset = static_cast<uint32_t>(offset);
+    toc[i].nameLength = static_cast<uint32_t>(assets[i].key.size());
+    offset += assets[i].key.size();
+  }
+  for (uint32_t i = 0; i < count; ++i) {
+    const sf::Vector2u size = assets[i].image.getSize();
+    offset = alignTo16(offset);
+    toc[i].dataOffset = offset;
+    toc[i].width = size.x;
+    toc[i].height = size.y;
+    offset += uint64_t(size.x) * size.y * 4;
+  }
+
+  // 3) Escribimos cabecera, tabla, nombres y pixeles
+  std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    std::cerr << "[AssetArchive] Cannot write: " << outputPath << "\n";
+    return false;
+  }
+  const Header header{ MAGIC, VERSION, count, 0 };
+  out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  out.write(reinterpret_cast<const char*>(toc.data()), toc.size() * sizeof(TocEntry));
+  for (const Asset& asset : assets) {
+    out.write(asset.key.data(), asset.key.size());
+  }
+  for (uint32_t i = 0; i < count; ++i) {
+    const uint64_t padding = toc[i].dataOffset - static_cast<uint64_t>(out.tellp());
+    static const char zeros[16] = {};
+    out.write(zeros, static_cast<std::streamsize>(padding));
+    out.write(reinterpret_cast<const char*>(assets[i].image.getPixelsPtr()),
+              static_cast<std::streamsize>(uint64_t(toc[i].width) * toc[i].height * 4));
+  }
+
+  if (!out) {
+    std::cerr << "[AssetArchive] Write failed: " << outputPath << "\n";
+    return false;
+  }
+  MESSAGE("AssetArchive", "pack", outputPath + " (" + std::to_string(count) + " assets)");
+  return true;
+}
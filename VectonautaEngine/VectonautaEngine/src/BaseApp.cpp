@@ -4,7 +4,16 @@
 #include "ECS/Actor.h"
 #include "ECS/Transform.h"
 #include "CShape.h"
+#include "ECS/PathFollower.h"
+#include "ECS/Systems/PathFollowSystem.h"
+#include "ECS/Systems/SeekSystem.h"
+#include "ECS/Systems/TransformSyncSystem.h"
+#include "ECS/Systems/RenderSystem.h"
+#include "Utilities/Profiler.h"
+#include <algorithm>
 #include <cmath>  
+#include <chrono>
+#include <iomanip>
 
 
 
@@ -13,47 +22,234 @@
  * @brief Implements the BaseApp class which manages the main application loop.
  */
 
+namespace {
+  /**
+   * @brief Keeps the result of measureActorIteration() observable so the pass is not dropped.
+   */
+  volatile float g_iterationSink = 0.f;
+}
+
 BaseApp::~BaseApp() {}
 
 // Ejecuta el ciclo principal
 int BaseApp::run() {
   if (!init()) {
-    ERROR("BaseApp", "run", "Initialization failed", "Check init() logic");
+    REPORT_ERROR(ErrorCode::FAILURE, "BaseApp", "run", "Initialization failed");
+    return 1;
   }
 
-  while (m_windowPtr->isOpen()) {
-    m_windowPtr->handleEvents();
-    update();
-    render();
+  using Clock = std::chrono::steady_clock;
+  auto seconds = [](Clock::time_point from, Clock::time_point to) {
+    return std::chrono::duration<double>(to - from).count();
+  };
+
+  PROFILE_THREAD("Main");
+  const bool profiling = !m_config.profileOutput.empty();
+  if (profiling) {
+    if (PROFILER_ENABLED) {
+      Profiler::start();
+    }
+    else {
+      MESSAGE("BaseApp", "run", "Profiling not compiled in (define VECTONAUTA_PROFILE)");
+    }
+  }
+
+  m_frameStats = FrameStats();
+  const Clock::time_point loopStart = Clock::now();
+  while (m_windowPtr->isOpen() &&
+         (m_config.frameCount == 0 || m_frameStats.frames < m_config.frameCount)) {
+    PROFILE_ZONE("Frame");
+    const Clock::time_point frameStart = Clock::now();
+    const uint64_t arenaHeapBefore = m_frameArena.getHeapAllocationCount();
+    {
+      PROFILE_ZONE("Events");
+      m_windowPtr->handleEvents();
+    }
+    const Clock::time_point eventsEnd = Clock::now();
+    {
+      PROFILE_ZONE("Update");
+      update();
+    }
+    const Clock::time_point updateEnd = Clock::now();
+    {
+      PROFILE_ZONE("Render");
+      render();
+    }
+    const Clock::time_point renderEnd = Clock::now();
+
+    m_frameStats.eventSeconds += seconds(frameStart, eventsEnd);
+    m_frameStats.updateSeconds += seconds(eventsEnd, updateEnd);
+    m_frameStats.renderSeconds += seconds(updateEnd, renderEnd);
+    if (m_renderSystem != nullptr) {
+      m_frameStats.drawCalls += m_renderSystem->getBatch().getDrawCallCount();
+      m_frameStats.shapes += m_renderSystem->getBatch().getShapeCount();
+    }
+    m_frameStats.arenaPeakBytes = std::max(m_frameStats.arenaPeakBytes, m_frameArena.getUsedBytes());
+    ++m_frameStats.frames;
+    m_frameArena.endFrame();
+    if (m_frameArena.getHeapAllocationCount() != arenaHeapBefore) {
+      m_frameStats.arenaLastHeapFrame = m_frameStats.frames;
+    }
+  }
+  m_frameStats.totalSeconds = seconds(loopStart, Clock::now());
+  m_frameStats.arenaHeapAllocations = m_frameArena.getHeapAllocationCount();
+  if (m_spatialGrid != nullptr) {
+    m_frameStats.grid = m_spatialGrid->getStats();
+  }
+
+  if (profiling && PROFILER_ENABLED) {
+    Profiler::stop();
+    if (!Profiler::writeChromeTrace(m_config.profileOutput)) {
+      MESSAGE("BaseApp", "run", "Cannot write profile " + m_config.profileOutput);
+    }
+  }
+
+  // Solo en modo benchmark (numero fijo de frames)
+  if (m_config.frameCount > 0) {
+    measureSpatialGrid();
+    measureActorIteration();
+    reportFrameStats();
   }
 
   destroy();
   return 0;
 }
 
+void
+BaseApp::reportFrameStats() const {
+  const double frames = m_frameStats.frames > 0 ? double(m_frameStats.frames) : 1.0;
+  const double fps = m_frameStats.totalSeconds > 0.0 ?
+                     m_frameStats.frames / m_frameStats.totalSeconds : 0.0;
+
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(3)
+     << "BaseApp::run : [FRAME STATS: " << m_frameStats.frames << " frames in "
+     << m_frameStats.totalSeconds << " s, " << fps << " fps, "
+     << m_frameStats.ticks << " ticks]\n"
+     << "  events : " << 1000.0 * m_frameStats.eventSeconds / frames << " ms/frame\n"
+     << "  update : " << 1000.0 * m_frameStats.updateSeconds / frames << " ms/frame\n"
+     << "  render : " << 1000.0 * m_frameStats.renderSeconds / frames << " ms/frame\n"
+     << "  draws  : " << m_frameStats.drawCalls / frames << " draw calls (texture binds) for "
+     << m_frameStats.shapes / frames << " shapes/frame, "
+     << (m_frameStats.drawCalls > 0 ? double(m_frameStats.shapes) / m_frameStats.drawCalls : 0.0)
+     << " shapes per call\n"
+     << "  physics: " << (m_frameStats.ticks > 0 ? double(m_frameStats.contacts) / m_frameStats.ticks : 0.0)
+     << " contacts/tick\n"
+     << "  arena  : " << m_frameStats.arenaPeakBytes << " bytes peak/frame, "
+     << m_frameStats.arenaHeapAllocations << " heap allocations, "
+     << (m_frameStats.frames - m_frameStats.arenaLastHeapFrame) << " of " << m_frameStats.frames
+     << " frames without one (SpriteBatch arrays)\n";
+
+  const SpatialGridStats& grid = m_frameStats.grid;
+  os << "  grid   : " << grid.rebuilds << " rebuilds ("
+     << (grid.rebuilds > 0 ? 1000.0 * grid.rebuildSeconds / grid.rebuilds : 0.0) << " ms each), "
+     << (grid.syncs > 0 ? 1000.0 * grid.syncSeconds / grid.syncs : 0.0) << " ms/sync over "
+     << grid.syncs << " syncs\n"
+     << "  queries: " << m_frameStats.gridEntities << " entities, rebuild "
+     << 1000.0 * m_frameStats.gridRebuildSeconds << " ms, "
+     << (m_frameStats.gridQuerySeconds > 0.0 ? m_frameStats.gridQueries / m_frameStats.gridQuerySeconds : 0.0)
+     << " radius queries/s, "
+     << (m_frameStats.gridQueries > 0 ? double(m_frameStats.gridQueryHits) / m_frameStats.gridQueries : 0.0)
+     << " hits/query\n";
+
+  os << "  pool   : " << (EngineUtilities::IsPoolingEnabled() ? "MakePooledShared" : "MakeShared")
+     << ", " << m_frameStats.respawns / frames << " respawns/frame, "
+     << (m_frameStats.respawns > 0 ? 1e6 * m_frameStats.churnSeconds / m_frameStats.respawns : 0.0)
+     << " us/respawn, iteration "
+     << (m_frameStats.iteratedActors > 0 ? 1e9 * m_frameStats.iterationSeconds / m_frameStats.iteratedActors : 0.0)
+     << " ns/actor\n";
+
+  const TextureCacheStats& cache = resourceMan.getStats();
+  os << "  textures : " << cache.hits << " hits, " << cache.misses << " misses, "
+     << cache.evictions << " evictions, " << cache.residentBytes << " bytes resident\n";
+  std::cout << os.str();
+}
+
+void
+BaseApp::measureSpatialGrid() {
+  constexpr uint32_t REBUILDS = 10;
+  using Clock = std::chrono::steady_clock;
+
+  std::vector<EntityHandle> handles;
+  std::vector<sf::Vector2f> positions;
+  m_storage.forEach(makeSignature<Transform>(), [&](Archetype& archetype) {
+    const std::vector<sf::Vector2f>& rows = archetype.getTransforms().positions;
+    for (uint32_t row = 0; row < archetype.size(); ++row) {
+      const EntityHandle handle = archetype.getEntity(row)->getHandle();
+      if (handle.isValid()) {
+        handles.push_back(handle);
+        positions.push_back(rows[row]);
+      }
+    }
+  });
+  const uint32_t count = static_cast<uint32_t>(handles.size());
+
+  // Misma configuracion que la rejilla del SpatialGridSystem
+  SpatialGrid grid(m_spatialGrid != nullptr ? m_spatialGrid->getGrid().getCellSize() : 64.f);
+  const Clock::time_point rebuildStart = Clock::now();
+  for (uint32_t i = 0; i < REBUILDS; ++i) {
+    grid.rebuild(handles.data(), positions.data(), count, &m_jobSystem);
+  }
+  const Clock::time_point queryStart = Clock::now();
+
+  // Una consulta del tamano de una celda alrededor de cada entidad, como haria un vecindario
+  std::vector<EntityHandle> found;
+  uint64_t hits = 0;
+  for (const sf::Vector2f& position : positions) {
+    found.clear();
+    grid.queryRadius(position, grid.getCellSize(), found);
+    hits += found.size();
+  }
+  const Clock::time_point queryEnd = Clock::now();
+
+  m_frameStats.gridEntities = count;
+  m_frameStats.gridRebuildSeconds = std::chrono::duration<double>(queryStart - rebuildStart).count() / REBUILDS;
+  m_frameStats.gridQueries = count;
+  m_frameStats.gridQueryHits = hits;
+  m_frameStats.gridQuerySeconds = std::chrono::duration<double>(queryEnd - queryStart).count();
+}
+
 // Inicializa la ventana y los actores
 bool BaseApp::init() {
+  EngineUtilities::SetPoolingEnabled(m_config.pooling);
+
   // 1) Crear ventana
-  m_windowPtr = EngineUtilities::MakeShared<Window>(1920, 1080, "VectonautaEngine");
+  m_windowPtr = EngineUtilities::MakeShared<Window>(1920, 1080, "VectonautaEngine",
+                                                    m_config.headless);
   if (!m_windowPtr) {
-    ERROR("BaseApp", "init", "Failed to create window", "Check memory allocation");
+    REPORT_ERROR(ErrorCode::RESOURCE_FAILURE, "BaseApp", "init", "Failed to create window");
     return false;
   }
 
+  // Sistemas por frame; el scheduler los ordena por sus componentes de lectura/escritura
+  m_scheduler.setJobSystem(&m_jobSystem);
+  m_scheduler.addSystem<SeekSystem>(&m_jobSystem);
+  m_scheduler.addSystem<PathFollowSystem>(&m_jobSystem);
+  m_spatialGrid = &m_scheduler.addSystem<SpatialGridSystem>(&m_jobSystem);
+  m_collisionSystem = &m_scheduler.addSystem<CollisionSystem>(&m_jobSystem);
+  m_transformSync = &m_scheduler.addSystem<TransformSyncSystem>(&m_jobSystem);
+  m_renderSystem = &m_scheduler.addSystem<RenderSystem>(m_windowPtr, m_frameArena);
+  resourceMan.setJobSystem(&m_jobSystem);
+  if (!m_config.assetArchive.empty()) {
+    // Sin archivo empaquetado (desarrollo) se usan los archivos sueltos
+    resourceMan.mountArchive(m_config.assetArchive);
+  }
+
   // 2) Cargar textura y crear actor de la pista
-  if (!resourceMan.loadTexture("Sprites/Track", "png")) {
+  if (resourceMan.loadTexture("Sprites/Track", "png") == TextureLoadState::Status::FAILED) {
     MESSAGE("BaseApp", "init", "Cannot load Track.png");
   }
   auto trackTex = resourceMan.getTexture("Sprites/Track");
 
-  m_trackActor = EngineUtilities::MakeShared<Actor>("Track");
-  if (auto shape = m_trackActor->getComponent<CShape>()) {
+  m_trackActor = m_registry.spawn<Actor>("Track", &m_storage);
+  Actor* track = m_registry.get<Actor>(m_trackActor);
+  if (auto shape = track->getComponent<CShape>()) {
     // Creamos un RECTANGLE y lo preparamos
     shape->createShape(ShapeType::RECTANGLE);
     shape->setFillColor(sf::Color::White);
 
     // Ajustamos el tamao del rectngulo al de la textura
-    auto texSize = trackTex->getTexture().getSize();
+    auto texSize = trackTex->getSize();
     if (auto rect = dynamic_cast<sf::RectangleShape*>(shape->getShape())) {
       rect->setSize({ float(texSize.x), float(texSize.y) });
       rect->setOrigin(0.f, 0.f);
@@ -64,69 +260,183 @@ bool BaseApp::init() {
     float scaleY = 1080.f / float(texSize.y);
     shape->setScale({ scaleX, scaleY });
   }
-  m_trackActor->setTexture(trackTex);
-  if (auto xf = m_trackActor->getComponent<Transform>()) {
+  track->setTexture(trackTex);
+  if (auto xf = track->getComponent<Transform>()) {
     xf->setPosition({ 0.f, 0.f });
   }
 
+  // Recorrido de la pista: una sola curva compartida por todos los actores que la siguen
+  m_trackPath = EngineUtilities::MakeShared<Path>(std::vector<sf::Vector2f>{
+      {400.f, 150.f},
+      {700.f, 300.f},
+      {1000.f, 150.f},
+      {1200.f, 500.f}
+    }, PathType::CATMULL_ROM, true);
+
   // 3) Crear y configurar actor de Mario
-  m_circleActor = EngineUtilities::MakeShared<Actor>("Mario Actor");
-  if (m_circleActor) {
-    if (auto shape = m_circleActor->getComponent<CShape>()) {
+  m_circleActor = m_registry.spawn<Actor>("Mario Actor", &m_storage);
+  if (Actor* mario = m_registry.get<Actor>(m_circleActor)) {
+    if (auto shape = mario->getComponent<CShape>()) {
       shape->createShape(ShapeType::CIRCLE);
       shape->setFillColor(sf::Color::White);
     }
-    if (auto xf = m_circleActor->getComponent<Transform>()) {
-      xf->setPosition({ 100.f, 150.f });
+    if (auto xf = mario->getComponent<Transform>()) {
+      xf->setPosition(m_trackPath->getPosition(0.f));
       xf->setScale({ 3.f, 3.f });
     }
-    if (!resourceMan.loadTexture("Sprites/Mario", "png")) {
-      MESSAGE("BaseApp", "init", "Cannot load Mario.png");
+    // Carga en segundo plano; mientras tanto se dibuja la textura "Default"
+    TextureRequest marioTexture = resourceMan.loadTextureAsync("Sprites/Mario", "png");
+    mario->setTexture(marioTexture.getTexture());
+    m_pendingTextures.push_back({ m_circleActor, marioTexture });
+
+    mario->addComponent(EngineUtilities::MakeShared<PathFollower>(m_trackPath, 200.f));
+    if (auto shape = mario->getComponent<CShape>()) {
+      mario->addComponent(EngineUtilities::MakeShared<Collider>(*shape));
     }
-    m_circleActor->setTexture(resourceMan.getTexture("Sprites/Mario"));
 
-    // Waypoints para movimiento
-    m_waypoints = {
-        {400.f, 150.f},
-        {700.f, 300.f},
-        {1000.f, 150.f},
-        {1200.f, 500.f}
-    };
-    m_currentWaypointIndex = 0;
+    // Multitud opcional repartida a lo largo del mismo recorrido
+    m_crowdTexture = marioTexture;
+    // main() ya la limita a CAPACITY; aqui se descuentan la pista y Mario
+    m_config.crowdSize = std::min(m_config.crowdSize, EntityRegistry::CAPACITY - m_registry.size());
+    m_crowd.reserve(m_config.crowdSize);
+    for (uint32_t i = 0; i < m_config.crowdSize; ++i) {
+      const EntityHandle handle = spawnCrowdActor(i);
+      if (!handle.isValid()) {
+        // Registro lleno (ya reportado): la multitud se queda con los que caben
+        m_crowd.shrink_to_fit();
+        break;
+      }
+      m_crowd.push_back(handle);
+    }
   }
   else {
-    ERROR("BaseApp", "init", "Failed to create Mario actor", "");
+    REPORT_ERROR(ErrorCode::RESOURCE_FAILURE, "BaseApp", "init", "Failed to create Mario actor");
     return false;
   }
 
   return true;
 }
 
+EntityHandle
+BaseApp::spawnCrowdActor(uint32_t index) {
+  const float distance = m_trackPath->getLength() * float(index + 1) / float(m_config.crowdSize + 1);
+  EntityHandle handle = m_registry.spawn<Actor>("Crowd Actor " + std::to_string(index), &m_storage);
+  Actor* follower = m_registry.get<Actor>(handle);
+  if (follower == nullptr) {
+    return EntityHandle();
+  }
+  if (auto shape = follower->getComponent<CShape>()) {
+    shape->createShape(ShapeType::CIRCLE);
+    shape->setFillColor(sf::Color::White);
+    follower->addComponent(EngineUtilities::MakeShared<Collider>(*shape));
+  }
+  if (auto xf = follower->getComponent<Transform>()) {
+    xf->setPosition(m_trackPath->getPosition(distance));
+    xf->setScale({ 2.f, 2.f });
+  }
+  follower->setTexture(m_crowdTexture.getTexture());
+  if (!m_crowdTexture.isDone()) {
+    m_pendingTextures.push_back({ handle, m_crowdTexture });
+  }
+  follower->addComponent(EngineUtilities::MakeShared<PathFollower>(m_trackPath, 200.f, distance));
+  return handle;
+}
+
+void
+BaseApp::churnCrowd() {
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point start = Clock::now();
+  const uint32_t count = std::min(m_config.churnPerFrame, static_cast<uint32_t>(m_crowd.size()));
+  for (uint32_t i = 0; i < count; ++i) {
+    // Se recorre la multitud en circulo, asi todos los actores viven lo mismo
+    const uint32_t index = m_churnCursor;
+    m_churnCursor = (m_churnCursor + 1) % static_cast<uint32_t>(m_crowd.size());
+    m_registry.destroy(m_crowd[index]);
+    m_crowd[index] = spawnCrowdActor(index);
+  }
+  m_frameStats.respawns += count;
+  m_frameStats.churnSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void
+BaseApp::measureActorIteration() {
+  constexpr uint32_t PASSES = 20;
+  using Clock = std::chrono::steady_clock;
+
+  // Mismo acceso que Actor::update: actor -> slot del componente -> objeto del componente
+  float sum = 0.f;
+  const Clock::time_point start = Clock::now();
+  for (uint32_t pass = 0; pass < PASSES; ++pass) {
+    for (const auto& entity : m_registry.getEntities()) {
+      const Transform* transform = entity->getComponentPtr<Transform>();
+      CShape* shape = entity->getComponentPtr<CShape>();
+      if (transform && shape) {
+        sum += transform->getPosition().x + (shape->getShape() ? 1.f : 0.f);
+      }
+    }
+  }
+  m_frameStats.iterationSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+  m_frameStats.iteratedActors = uint64_t(PASSES) * m_registry.size();
+  g_iterationSink = sum;
+}
+
 // Actualiza la lgica de la aplicacin cada frame
 void BaseApp::update() {
-  float dt = m_windowPtr->deltaTime.asSeconds();
+  float frameTime = m_windowPtr->deltaTime.asSeconds();
   m_windowPtr->update();
+  if (m_config.fixedTimestep > 0.f) {
+    // Tiempo de frame fijo: la simulacion no depende del reloj (benchmarks reproducibles)
+    frameTime = m_config.fixedTimestep;
+  }
+
+  if (m_config.churnPerFrame > 0 && !m_crowd.empty()) {
+    churnCrowd();
+  }
 
-  if (!m_trackActor.isNull()) {
-    m_trackActor->update(dt);
+  // Subidas a GPU pendientes y cambio de placeholder por la textura real
+  resourceMan.update();
+  for (size_t i = 0; i < m_pendingTextures.size();) {
+    if (!m_pendingTextures[i].second.isDone()) {
+      ++i;
+      continue;
+    }
+    if (Actor* actor = m_registry.get<Actor>(m_pendingTextures[i].first)) {
+      actor->setTexture(m_pendingTextures[i].second.getTexture());
+    }
+    m_pendingTextures[i] = m_pendingTextures.back();
+    m_pendingTextures.pop_back();
   }
 
-  if (!m_circleActor.isNull() && !m_waypoints.empty()) {
-    m_circleActor->update(dt);
+  // La simulacion avanza en ticks de duracion fija, tantos como quepan en el tiempo acumulado
+  const float tick = 1.f / (m_config.tickRate > 0.f ? m_config.tickRate : 60.f);
+  m_accumulator += frameTime;
+  uint32_t steps = 0;
+  while (m_accumulator >= tick && steps < m_config.maxSubsteps) {
+    fixedUpdate(tick);
+    m_accumulator -= tick;
+    ++steps;
+  }
+  if (m_accumulator >= tick) {
+    // Demasiado atrasados: se descarta el tiempo sobrante (evita la espiral de la muerte)
+    m_accumulator = std::fmod(m_accumulator, tick);
+  }
+  m_frameStats.ticks += steps;
 
-    auto xf = m_circleActor->getComponent<Transform>();
-    auto target = m_waypoints[m_currentWaypointIndex];
-    auto pos = xf->getPosition();
+  // El render mezcla el tick anterior y el actual segun el tiempo que sobra
+  if (m_transformSync != nullptr) {
+    m_transformSync->setAlpha(m_accumulator / tick);
+  }
+}
 
-    float dx = target.x - pos.x;
-    float dy = target.y - pos.y;
-    float dist = std::sqrt(dx * dx + dy * dy);
+// Un tick de simulacion de duracion fija
+void BaseApp::fixedUpdate(float dt) {
+  PROFILE_ZONE("FixedUpdate");
+  m_storage.storePreviousTransforms();
 
-    if (dist < 10.f) {
-      if (++m_currentWaypointIndex >= static_cast<int>(m_waypoints.size()))
-        m_currentWaypointIndex = 0;
-    }
-    xf->seek(target, 200.f, dt, 10.f);
+  // Movimiento, rejilla espacial y colisiones sobre todas las entidades del almacenamiento
+  m_scheduler.run(SystemPhase::UPDATE, m_storage, dt);
+  if (m_collisionSystem != nullptr) {
+    m_frameStats.contacts += m_collisionSystem->getContacts().size();
   }
 }
 
@@ -134,11 +444,7 @@ void BaseApp::update() {
 void BaseApp::render() {
   m_windowPtr->clear();
 
-  if (!m_trackActor.isNull())
-    m_trackActor->render(m_windowPtr);
-
-  if (!m_circleActor.isNull())
-    m_circleActor->render(m_windowPtr);
+  m_scheduler.run(SystemPhase::RENDER, m_storage, 0.f);
 
   m_windowPtr->display();
 }
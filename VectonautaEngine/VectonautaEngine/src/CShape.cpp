@@ -4,6 +4,7 @@
 #include "Memory/TUniquePtr.h"
 #include <Memory/TSharedPointer.h>
 #include <ECS/Texture.h>
+#include "ECS/Sprite.h"
 /**
  * @file CShape.cpp
  * @brief Implementation of the CShape class for creating and manipulating different SFML shapes.
@@ -16,8 +17,9 @@
   * The shape is stored internally using a shared pointer.
   *
   * @param shapeType The type of shape to create.
+  * @return ErrorCode::OK, or ErrorCode::INVALID_ARGUMENT for an unknown type.
   */
-void
+ErrorCode
 CShape::createShape(ShapeType shapeType) {
   m_shapeType = shapeType;
 
@@ -56,9 +58,9 @@ CShape::createShape(ShapeType shapeType) {
   }
   default:
     m_shapePtr.reset();
-    ERROR("CShape", "createShape", "Unknown shape type");
-    return;
+    return REPORT_ERROR(ErrorCode::INVALID_ARGUMENT, "CShape", "createShape", "Unknown shape type");
   }
+  return ErrorCode::OK;
 }
 
 CShape::CShape()
@@ -98,11 +100,11 @@ CShape::destroy() {
  */
 void
 CShape::render(const EngineUtilities::TSharedPointer<Window>& window) {
-  if (m_shapePtr) {
+  if (VECTONAUTA_LIKELY(m_shapePtr)) {
     window->draw(*m_shapePtr);
   }
   else {
-    ERROR("CShape", "render", "Shape is not initialized.");
+    REPORT_ERROR(ErrorCode::NOT_INITIALIZED, "CShape", "render", "Shape is not initialized.");
   }
 }
 
@@ -114,11 +116,11 @@ CShape::render(const EngineUtilities::TSharedPointer<Window>& window) {
  */
 void
 CShape::setPosition(float x, float y) {
-  if (m_shapePtr) {
+  if (VECTONAUTA_LIKELY(m_shapePtr)) {
     m_shapePtr->setPosition(x, y);
   }
   else {
-    ERROR("CShape", "setPosition", "Shape is not initialized.");
+    REPORT_ERROR(ErrorCode::NOT_INITIALIZED, "CShape", "setPosition", "Shape is not initialized.");
   }
 }
 
@@ -129,11 +131,11 @@ CShape::setPosition(float x, float y) {
  */
 void
 CShape::setPosition(const sf::Vector2f& position) {
-  if (m_shapePtr) {
+  if (VECTONAUTA_LIKELY(m_shapePtr)) {
     m_shapePtr->setPosition(position);
   }
   else {
-    ERROR("CShape", "setPosition", "Shape is not initialized.");
+    REPORT_ERROR(ErrorCode::NOT_INITIALIZED, "CShape", "setPosition", "Shape is not initialized.");
   }
 }
 
@@ -144,11 +146,11 @@ CShape::setPosition(const sf::Vector2f& position) {
  */
 void
 CShape::setFillColor(const sf::Color& color) {
-  if (m_shapePtr) {
+  if (VECTONAUTA_LIKELY(m_shapePtr)) {
     m_shapePtr->setFillColor(color);
   }
   else {
-    ERROR("CShape", "setFillColor", "Shape is not initialized.");
+    REPORT_ERROR(ErrorCode::NOT_INITIALIZED, "CShape", "setFillColor", "Shape is not initialized.");
   }
 }
 
@@ -160,11 +162,11 @@ CShape::setFillColor(const sf::Color& color) {
 void
 CShape::setRotation(float angle)
 {
-  if (m_shapePtr) {
+  if (VECTONAUTA_LIKELY(m_shapePtr)) {
     m_shapePtr->setRotation(angle);
   }
   else {
-    ERROR("CShape", "setRotation", "Shape is not initialized.");
+    REPORT_ERROR(ErrorCode::NOT_INITIALIZED, "CShape", "setRotation", "Shape is not initialized.");
   }
 }
 
@@ -175,11 +177,11 @@ CShape::setRotation(float angle)
  */
 void
 CShape::setScale(const sf::Vector2f& scale) {
-  if (m_shapePtr) {
+  if (VECTONAUTA_LIKELY(m_shapePtr)) {
     m_shapePtr->setScale(scale);
   }
   else {
-    ERROR("CShape", "setScale", "Shape is not initialized.");
+    REPORT_ERROR(ErrorCode::NOT_INITIALIZED, "CShape", "setScale", "Shape is not initialized.");
   }
 }
 
@@ -191,7 +193,18 @@ sf::Shape* CShape::getShape()
 void
 CShape::setTexture(const EngineUtilities::TSharedPointer<Texture>& texture) {
   if (m_shapePtr.get() && texture && !texture.isNull()) {
-    // sf::Shape::setTexture recibe puntero a sf::Texture
+    // sf::Shape::setTexture recibe puntero a sf::Texture; con atlas es la pagina
+    // entera, asi que el rect se ajusta a la zona de esta textura
     m_shapePtr->setTexture(&texture->getTexture());
+    m_shapePtr->setTextureRect(texture->getTextureRect());
+  }
+}
+
+void
+CShape::applySprite(const Sprite& sprite) {
+  if (m_shapePtr.get() && !sprite.getTexture().isNull()) {
+    m_shapePtr->setTexture(&sprite.getTexture()->getTexture());
+    m_shapePtr->setTextureRect(sprite.getUVRect());
+    m_shapePtr->setFillColor(sprite.getTint());
   }
 }
\ No newline at end of file
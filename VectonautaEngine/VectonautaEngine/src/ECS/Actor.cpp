@@ -2,15 +2,20 @@
 #include "CShape.h"
 #include "ECS/Transform.h"
 #include "ECS/Texture.h"
+#include "ECS/Sprite.h"
+#include "ECS/ArchetypeStorage.h"
 
-Actor::Actor(const std::string& actorName) {
+Actor::Actor(const std::string& actorName, ArchetypeStorage* storage) {
   m_name = actorName;
 
-  auto shape = EngineUtilities::MakeShared<CShape>();
+  auto shape = EngineUtilities::MakePooledShared<CShape>();
   addComponent(shape);
 
-  auto transform = EngineUtilities::MakeShared<Transform>();
+  auto transform = EngineUtilities::MakePooledShared<Transform>();
   addComponent(transform);
+
+  // Se une al almacenamiento una vez que tiene sus componentes base
+  setStorage(storage);
 }
 
 void Actor::start() {
@@ -22,8 +27,8 @@ void Actor::destroy() {
 }
 
 void Actor::update(float deltaTime) {
-  auto transform = getComponent<Transform>();
-  auto shape = getComponent<CShape>();
+  Transform* transform = getComponentPtr<Transform>();
+  CShape* shape = getComponentPtr<CShape>();
 
   if (transform && shape) {
     shape->setPosition(transform->getPosition());
@@ -33,21 +38,41 @@ void Actor::update(float deltaTime) {
 }
 
 void Actor::render(const EngineUtilities::TSharedPointer<Window>& window) {
-  for (auto& comp : components) {
-    auto shape = comp.template dynamic_pointer_cast<CShape>();
-    if (shape) {
-      shape->render(window);
+  // Todas las figuras, no solo la indexada; el tipo evita el dynamic_cast
+  for (auto& component : components) {
+    if (component->getType() == ComponentType::SHAPE) {
+      static_cast<CShape*>(component.get())->render(window);
     }
   }
 }
 
 void
 Actor::setTexture(const EngineUtilities::TSharedPointer<Texture>& texture) {
-  auto shape = getComponent<CShape>();
-  if (shape) {
-    if (!texture.isNull()) {
-      shape->setTexture(texture);
-      addComponent(texture);
+  CShape* shape = getComponentPtr<CShape>();
+  if (shape && !texture.isNull()) {
+    // El actor solo guarda una referencia ligera; la textura vive en el ResourceManager
+    Sprite* sprite = getComponentPtr<Sprite>();
+    if (sprite) {
+      sprite->setTexture(texture);
+    }
+    else {
+      const sf::Color tint = shape->getShape() ? shape->getShape()->getFillColor() : sf::Color::White;
+      auto newSprite = EngineUtilities::MakeShared<Sprite>(texture, tint);
+      sprite = newSprite.get();
+      addComponent(newSprite);
     }
+    shape->applySprite(*sprite);
+  }
+}
+
+void
+Actor::setTint(const sf::Color& tint) {
+  Sprite* sprite = getComponentPtr<Sprite>();
+  CShape* shape = getComponentPtr<CShape>();
+  if (sprite) {
+    sprite->setTint(tint);
+  }
+  if (shape) {
+    shape->setFillColor(tint);
   }
 }
@@ -0,0 +1,85 @@
+#include "ECS/Archetype.h"
+#include "ECS/Entity.h"
+#include "ECS/Transform.h"
+
+/**
+ * @file Archetype.cpp
+ * @brief Implements row insertion and swap-and-pop removal for Archetype tables.
+ */
+
+Archetype::Archetype(const ComponentSignature& signature)
+  : m_signature(signature),
+  m_hasTransform(signature.test(ComponentTypeID::get<Transform>())) {
+}
+
+uint32_t
+Archetype::addEntity(Entity& entity) {
+  const uint32_t row = size();
+  m_entities.push_back(&entity);
+
+  for (uint32_t typeId = 0; typeId < MAX_COMPONENT_TYPES; ++typeId) {
+    if (m_signature.test(typeId)) {
+      m_columns[typeId].push_back(entity.getComponentById(typeId));
+    }
+  }
+
+  if (m_hasTransform) {
+    Transform* transform = getComponent<Transform>(row);
+    m_transforms.positions.push_back(transform->getPosition());
+    m_transforms.rotations.push_back(transform->getRotation());
+    m_transforms.scales.push_back(transform->getScale());
+    m_transforms.previousPositions.push_back(transform->getPosition());
+    m_transforms.previousRotations.push_back(transform->getRotation());
+    m_transforms.previousScales.push_back(transform->getScale());
+    transform->bindColumns(&m_transforms, row);
+  }
+
+  entity.m_archetype = this;
+  entity.m_archetypeRow = row;
+  return row;
+}
+
+void
+Archetype::removeEntity(uint32_t row) {
+  const uint32_t last = size() - 1;
+
+  if (m_hasTransform) {
+    getComponent<Transform>(row)->unbindColumns();
+  }
+  m_entities[row]->m_archetype = nullptr;
+  m_entities[row]->m_archetypeRow = 0;
+
+  if (row != last) {
+    m_entities[row] = m_entities[last];
+    m_entities[row]->m_archetypeRow = row;
+    for (uint32_t typeId = 0; typeId < MAX_COMPONENT_TYPES; ++typeId) {
+      if (m_signature.test(typeId)) {
+        m_columns[typeId][row] = m_columns[typeId][last];
+      }
+    }
+    if (m_hasTransform) {
+      m_transforms.positions[row] = m_transforms.positions[last];
+      m_transforms.rotations[row] = m_transforms.rotations[last];
+      m_transforms.scales[row] = m_transforms.scales[last];
+      m_transforms.previousPositions[row] = m_transforms.previousPositions[last];
+      m_transforms.previousRotations[row] = m_transforms.previousRotations[last];
+      m_transforms.previousScales[row] = m_transforms.previousScales[last];
+      getComponent<Transform>(row)->bindColumns(&m_transforms, row);
+    }
+  }
+
+  m_entities.pop_back();
+  for (uint32_t typeId = 0; typeId < MAX_COMPONENT_TYPES; ++typeId) {
+    if (m_signature.test(typeId)) {
+      m_columns[typeId].pop_back();
+    }
+  }
+  if (m_hasTransform) {
+    m_transforms.positions.pop_back();
+    m_transforms.rotations.pop_back();
+    m_transforms.scales.pop_back();
+    m_transforms.previousPositions.pop_back();
+    m_transforms.previousRotations.pop_back();
+    m_transforms.previousScales.pop_back();
+  }
+}
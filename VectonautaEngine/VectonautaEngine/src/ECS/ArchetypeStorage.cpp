@@ -0,0 +1,74 @@
+#include "ECS/ArchetypeStorage.h"
+#include "ECS/Entity.h"
+
+/**
+ * @file ArchetypeStorage.cpp
+ * @brief Implements archetype lookup and entity migration between archetypes.
+ */
+
+ArchetypeStorage::~ArchetypeStorage() {
+  for (auto& archetype : m_archetypes) {
+    while (archetype->size() > 0) {
+      Entity* entity = archetype->getEntity(archetype->size() - 1);
+      archetype->removeEntity(archetype->size() - 1);
+      entity->m_storage = nullptr;
+    }
+  }
+}
+
+void
+ArchetypeStorage::attach(Entity& entity) {
+  if (entity.m_storage == this) {
+    return;
+  }
+  if (entity.m_storage != nullptr) {
+    entity.m_storage->detach(entity);
+  }
+  entity.m_storage = this;
+  findOrCreate(entity.getSignature()).addEntity(entity);
+}
+
+void
+ArchetypeStorage::detach(Entity& entity) {
+  if (entity.m_storage != this) {
+    return;
+  }
+  if (entity.m_archetype != nullptr) {
+    entity.m_archetype->removeEntity(entity.m_archetypeRow);
+  }
+  entity.m_storage = nullptr;
+}
+
+void
+ArchetypeStorage::refresh(Entity& entity) {
+  if (entity.m_storage != this) {
+    return;
+  }
+  if (entity.m_archetype != nullptr &&
+      entity.m_archetype->getSignature() == entity.getSignature()) {
+    return;
+  }
+  if (entity.m_archetype != nullptr) {
+    entity.m_archetype->removeEntity(entity.m_archetypeRow);
+  }
+  findOrCreate(entity.getSignature()).addEntity(entity);
+}
+
+Archetype&
+ArchetypeStorage::findOrCreate(const ComponentSignature& signature) {
+  auto it = m_archetypeLookup.find(signature);
+  if (it != m_archetypeLookup.end()) {
+    return *m_archetypes[it->second];
+  }
+
+  m_archetypes.push_back(EngineUtilities::TUniquePtr<Archetype>(new Archetype(signature)));
+  m_archetypeLookup[signature] = m_archetypes.size() - 1;
+  return *m_archetypes.back();
+}
+
+void
+ArchetypeStorage::storePreviousTransforms() {
+  for (auto& archetype : m_archetypes) {
+    archetype->getTransforms().storePrevious();
+  }
+}
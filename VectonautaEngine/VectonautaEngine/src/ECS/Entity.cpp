@@ -0,0 +1,41 @@
+#include "ECS/Entity.h"
+#include "ECS/ArchetypeStorage.h"
+
+/**
+ * @file Entity.cpp
+ * @brief Implements the archetype storage hooks of Entity.
+ */
+
+Entity::~Entity() {
+  if (m_storage != nullptr) {
+    m_storage->detach(*this);
+  }
+}
+
+void
+Entity::setStorage(ArchetypeStorage* storage) {
+  if (storage == m_storage) {
+    return;
+  }
+  if (m_storage != nullptr) {
+    m_storage->detach(*this);
+  }
+  if (storage != nullptr) {
+    storage->attach(*this);
+  }
+}
+
+void
+Entity::onSignatureChanged() {
+  if (m_storage != nullptr) {
+    m_storage->refresh(*this);
+  }
+}
+
+void
+Entity::onComponentReplaced(uint32_t typeId) {
+  if (m_archetype != nullptr) {
+    m_archetype->setComponent(typeId, m_archetypeRow,
+                              components[m_componentSlots[typeId]].get());
+  }
+}
@@ -0,0 +1,89 @@
+#include "ECS/EntityRegistry.h"
+
+/**
+ * @file EntityRegistry.cpp
+ * @brief Implements slot allocation, the free list and dense swap-and-pop removal.
+ */
+
+EntityHandle
+EntityRegistry::add(const EngineUtilities::TSharedPointer<Entity>& entity) {
+  if (entity.isNull()) {
+    return EntityHandle();
+  }
+
+  uint32_t slotIndex;
+  if (m_freeHead != NONE) {
+    slotIndex = m_freeHead;
+    m_freeHead = m_slots[slotIndex].nextFree;
+    if (m_freeHead == NONE) {
+      m_freeTail = NONE;
+    }
+  }
+  else {
+    // El indice INDEX_MASK no se usa: con la generacion maxima empaquetaria a INVALID
+    if (m_slots.size() >= CAPACITY) {
+      REPORT_ERROR(ErrorCode::RESOURCE_FAILURE, "EntityRegistry", "add", "Registry is full");
+      return EntityHandle();
+    }
+    slotIndex = static_cast<uint32_t>(m_slots.size());
+    m_slots.push_back(Slot());
+  }
+
+  Slot& slot = m_slots[slotIndex];
+  slot.denseIndex = static_cast<uint32_t>(m_entities.size());
+  slot.nextFree = NONE;
+  m_entities.push_back(entity);
+  m_denseToSlot.push_back(slotIndex);
+
+  const EntityHandle handle(slotIndex, slot.generation);
+  entity->id = handle.value;
+  entity->isActive = true;
+  return handle;
+}
+
+bool
+EntityRegistry::destroy(EntityHandle handle) {
+  if (!isAlive(handle)) {
+    return false;
+  }
+
+  const uint32_t slotIndex = handle.getIndex();
+  Slot& slot = m_slots[slotIndex];
+  const uint32_t denseIndex = slot.denseIndex;
+
+  Entity& entity = *m_entities[denseIndex];
+  entity.destroy();
+  entity.setStorage(nullptr);
+  entity.isActive = false;
+  entity.id = EntityHandle::INVALID;
+
+  // Swap-and-pop para mantener el arreglo denso
+  const uint32_t last = static_cast<uint32_t>(m_entities.size()) - 1;
+  if (denseIndex != last) {
+    m_entities[denseIndex] = std::move(m_entities[last]);
+    m_denseToSlot[denseIndex] = m_denseToSlot[last];
+    m_slots[m_denseToSlot[denseIndex]].denseIndex = denseIndex;
+  }
+  m_entities.pop_back();
+  m_denseToSlot.pop_back();
+
+  // Nueva generacion: los handles viejos a este slot quedan invalidos
+  slot.denseIndex = FREE;
+  slot.generation = (slot.generation + 1) & EntityHandle::GENERATION_MASK;
+  slot.nextFree = NONE;
+  if (m_freeTail != NONE) {
+    m_slots[m_freeTail].nextFree = slotIndex;
+  }
+  else {
+    m_freeHead = slotIndex;
+  }
+  m_freeTail = slotIndex;
+  return true;
+}
+
+void
+EntityRegistry::reserve(uint32_t count) {
+  m_slots.reserve(count);
+  m_entities.reserve(count);
+  m_denseToSlot.reserve(count);
+}
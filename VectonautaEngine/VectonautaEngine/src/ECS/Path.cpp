@@ -0,0 +1,124 @@
+#include "ECS/Path.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @file Path.cpp
+ * @brief Implements spline evaluation and arc-length resampling for Path.
+ */
+
+namespace {
+  /**
+   * @brief Points evaluated per segment before resampling by arc length.
+   */
+  constexpr uint32_t SUBDIVISIONS = 32;
+
+  /**
+   * @brief Evaluates a uniform Catmull-Rom segment between p1 and p2.
+   */
+  sf::Vector2f
+  catmullRom(const sf::Vector2f& p0,
+             const sf::Vector2f& p1,
+             const sf::Vector2f& p2,
+             const sf::Vector2f& p3,
+             float t) {
+    const float t2 = t * t;
+    const float t3 = t2 * t;
+    return 0.5f * ((2.f * p1) +
+                   (p2 - p0) * t +
+                   (2.f * p0 - 5.f * p1 + 4.f * p2 - p3) * t2 +
+                   (3.f * p1 - p0 - 3.f * p2 + p3) * t3);
+  }
+
+  float
+  segmentLength(const sf::Vector2f& a, const sf::Vector2f& b) {
+    const sf::Vector2f d = b - a;
+    return std::sqrt(d.x * d.x + d.y * d.y);
+  }
+}
+
+Path::Path(const std::vector<sf::Vector2f>& points,
+           PathType type,
+           bool closed,
+           float spacing)
+  : m_closed(closed) {
+  const size_t count = points.size();
+  if (count < 2 || spacing <= 0.f) {
+    // Camino degenerado: siempre devuelve el primer punto
+    const sf::Vector2f only = count > 0 ? points[0] : sf::Vector2f(0.f, 0.f);
+    m_samples.assign(2, only);
+    return;
+  }
+
+  auto point = [&points, count, closed](int64_t i) -> const sf::Vector2f& {
+    if (closed) {
+      return points[static_cast<size_t>((i % int64_t(count) + int64_t(count)) % int64_t(count))];
+    }
+    return points[static_cast<size_t>(std::clamp<int64_t>(i, 0, int64_t(count) - 1))];
+  };
+
+  // 1) Curva densa con su longitud acumulada
+  const size_t segments = closed ? count : count - 1;
+  std::vector<sf::Vector2f> dense;
+  std::vector<float> lengths;
+  dense.reserve(segments * SUBDIVISIONS + 1);
+  lengths.reserve(segments * SUBDIVISIONS + 1);
+  dense.push_back(points[0]);
+  lengths.push_back(0.f);
+  for (size_t s = 0; s < segments; ++s) {
+    const int64_t i = int64_t(s);
+    for (uint32_t step = 1; step <= SUBDIVISIONS; ++step) {
+      const float t = float(step) / float(SUBDIVISIONS);
+      sf::Vector2f p;
+      if (type == PathType::CATMULL_ROM) {
+        p = catmullRom(point(i - 1), point(i), point(i + 1), point(i + 2), t);
+      }
+      else {
+        p = point(i) + (point(i + 1) - point(i)) * t;
+      }
+      lengths.push_back(lengths.back() + segmentLength(dense.back(), p));
+      dense.push_back(p);
+    }
+  }
+  m_length = lengths.back();
+  if (m_length <= 0.f) {
+    m_samples.assign(2, points[0]);
+    return;
+  }
+
+  // 2) Remuestreo a pasos iguales de distancia; el ultimo cae justo en el final
+  const size_t steps = std::max<size_t>(1, static_cast<size_t>(std::ceil(m_length / spacing)));
+  const float step = m_length / float(steps);
+  m_invSpacing = 1.f / step;
+  m_samples.reserve(steps + 1);
+  size_t j = 0;
+  for (size_t k = 0; k <= steps; ++k) {
+    const float target = std::min(float(k) * step, m_length);
+    while (j + 2 < lengths.size() && lengths[j + 1] < target) {
+      ++j;
+    }
+    const float span = lengths[j + 1] - lengths[j];
+    const float t = span > 0.f ? (target - lengths[j]) / span : 0.f;
+    m_samples.push_back(dense[j] + (dense[j + 1] - dense[j]) * std::clamp(t, 0.f, 1.f));
+  }
+}
+
+float
+Path::wrapDistance(float distance) const {
+  if (m_length <= 0.f) {
+    return 0.f;
+  }
+  if (m_closed) {
+    distance = std::fmod(distance, m_length);
+    return distance < 0.f ? distance + m_length : distance;
+  }
+  return std::clamp(distance, 0.f, m_length);
+}
+
+sf::Vector2f
+Path::getPosition(float distance) const {
+  const float f = wrapDistance(distance) * m_invSpacing;
+  const size_t i = std::min(static_cast<size_t>(f), m_samples.size() - 2);
+  const float t = f - float(i);
+  return m_samples[i] + (m_samples[i + 1] - m_samples[i]) * t;
+}
@@ -0,0 +1,264 @@
+#include "ECS/SpatialGrid.h"
+#include "Jobs/JobSystem.h"
+#include <algorithm>
+
+/**
+ * @file SpatialGrid.cpp
+ * @brief Implements the sharded uniform-grid spatial hash.
+ */
+
+namespace {
+  /**
+   * @brief Entries handed to each job when computing cells in parallel.
+   */
+  constexpr uint32_t ENTRIES_PER_JOB = 4096;
+}
+
+SpatialGrid::SpatialGrid(float cellSize)
+  : m_cellSize(cellSize > 0.f ? cellSize : 64.f),
+  m_invCellSize(1.f / m_cellSize) {
+}
+
+uint32_t
+SpatialGrid::findEntry(EntityHandle handle) const {
+  const uint32_t index = handle.getIndex();
+  if (!handle.isValid() || index >= m_handleToEntry.size()) {
+    return NONE;
+  }
+  const uint32_t entry = m_handleToEntry[index];
+  return entry != NONE && m_entries[entry].handle == handle ? entry : NONE;
+}
+
+const std::vector<uint32_t>*
+SpatialGrid::findCell(uint64_t cell) const {
+  const CellMap& shard = m_shards[shardOf(cell)];
+  auto it = shard.find(cell);
+  return it != shard.end() ? &it->second : nullptr;
+}
+
+void
+SpatialGrid::linkEntry(uint32_t index) {
+  Entry& entry = m_entries[index];
+  std::vector<uint32_t>& cell = m_shards[entry.shard][entry.cell];
+  entry.cellSlot = static_cast<uint32_t>(cell.size());
+  cell.push_back(index);
+}
+
+void
+SpatialGrid::unlinkEntry(uint32_t index) {
+  const Entry& entry = m_entries[index];
+  // Las celdas vacias se conservan para no reservar memoria si la entidad vuelve
+  std::vector<uint32_t>& cell = m_shards[entry.shard][entry.cell];
+  const uint32_t moved = cell.back();
+  cell[entry.cellSlot] = moved;
+  m_entries[moved].cellSlot = entry.cellSlot;
+  cell.pop_back();
+}
+
+void
+SpatialGrid::eraseEntry(uint32_t index) {
+  unlinkEntry(index);
+  m_handleToEntry[m_entries[index].handle.getIndex()] = NONE;
+
+  const uint32_t last = static_cast<uint32_t>(m_entries.size() - 1);
+  if (index != last) {
+    m_entries[index] = m_entries[last];
+    const Entry& moved = m_entries[index];
+    m_shards[moved.shard][moved.cell][moved.cellSlot] = index;
+    m_handleToEntry[moved.handle.getIndex()] = index;
+  }
+  m_entries.pop_back();
+}
+
+void
+SpatialGrid::insert(EntityHandle handle, const sf::Vector2f& position) {
+  if (!handle.isValid() || update(handle, position)) {
+    return;
+  }
+
+  const uint32_t slot = handle.getIndex();
+  if (slot >= m_handleToEntry.size()) {
+    m_handleToEntry.resize(slot + 1, NONE);
+  }
+  else if (m_handleToEntry[slot] != NONE) {
+    // El slot pertenece a una generacion anterior de la entidad
+    eraseEntry(m_handleToEntry[slot]);
+  }
+
+  Entry entry;
+  entry.handle = handle;
+  entry.position = position;
+  entry.cell = packCell(toCell(position.x), toCell(position.y));
+  entry.shard = shardOf(entry.cell);
+  entry.stamp = m_syncStamp;
+
+  const uint32_t index = static_cast<uint32_t>(m_entries.size());
+  m_entries.push_back(entry);
+  m_handleToEntry[slot] = index;
+  linkEntry(index);
+}
+
+bool
+SpatialGrid::update(EntityHandle handle, const sf::Vector2f& position) {
+  const uint32_t index = findEntry(handle);
+  if (index == NONE) {
+    return false;
+  }
+
+  Entry& entry = m_entries[index];
+  entry.position = position;
+  entry.stamp = m_syncStamp;
+  const uint64_t cell = packCell(toCell(position.x), toCell(position.y));
+  if (cell != entry.cell) {
+    unlinkEntry(index);
+    entry.cell = cell;
+    entry.shard = shardOf(cell);
+    linkEntry(index);
+  }
+  return true;
+}
+
+bool
+SpatialGrid::remove(EntityHandle handle) {
+  const uint32_t index = findEntry(handle);
+  if (index == NONE) {
+    return false;
+  }
+  eraseEntry(index);
+  return true;
+}
+
+void
+SpatialGrid::clear() {
+  m_entries.clear();
+  m_handleToEntry.clear();
+  for (CellMap& shard : m_shards) {
+    shard.clear();
+  }
+}
+
+void
+SpatialGrid::rebuild(const EntityHandle* handles,
+                     const sf::Vector2f* positions,
+                     uint32_t count,
+                     JobSystem* jobSystem) {
+  m_entries.resize(count);
+  std::fill(m_handleToEntry.begin(), m_handleToEntry.end(), NONE);
+
+  // 1) Celda de cada entidad, en paralelo
+  auto computeCells = [this, handles, positions](uint32_t first, uint32_t last) {
+    for (uint32_t i = first; i < last; ++i) {
+      Entry& entry = m_entries[i];
+      entry.handle = handles[i];
+      entry.position = positions[i];
+      entry.cell = packCell(toCell(positions[i].x), toCell(positions[i].y));
+      entry.shard = shardOf(entry.cell);
+      entry.stamp = m_syncStamp;
+    }
+  };
+  if (jobSystem) {
+    jobSystem->parallelFor(0, count, ENTRIES_PER_JOB, computeCells);
+  }
+  else {
+    computeCells(0, count);
+  }
+
+  // 2) Tabla handle -> entrada, y cuantas entradas tiene cada shard
+  std::array<uint32_t, SHARD_COUNT + 1> shardStart{};
+  for (uint32_t i = 0; i < count; ++i) {
+    const uint32_t slot = handles[i].getIndex();
+    if (slot >= m_handleToEntry.size()) {
+      m_handleToEntry.resize(slot + 1, NONE);
+    }
+    m_handleToEntry[slot] = i;
+    ++shardStart[m_entries[i].shard + 1];
+  }
+
+  // 3) Ordenacion por conteo: las entradas de cada shard quedan seguidas y en orden
+  for (uint32_t s = 0; s < SHARD_COUNT; ++s) {
+    shardStart[s + 1] += shardStart[s];
+  }
+  m_shardEntries.resize(count);
+  std::array<uint32_t, SHARD_COUNT> next;
+  std::copy(shardStart.begin(), shardStart.end() - 1, next.begin());
+  for (uint32_t i = 0; i < count; ++i) {
+    m_shardEntries[next[m_entries[i].shard]++] = i;
+  }
+
+  // 4) Cada shard recoge solo sus entradas; los shards no comparten celdas, asi que no hay carreras
+  auto fillShards = [this, &shardStart](uint32_t first, uint32_t last) {
+    for (uint32_t s = first; s < last; ++s) {
+      CellMap& shard = m_shards[s];
+      for (auto& cell : shard) {
+        cell.second.clear();
+      }
+      for (uint32_t k = shardStart[s]; k < shardStart[s + 1]; ++k) {
+        const uint32_t i = m_shardEntries[k];
+        Entry& entry = m_entries[i];
+        std::vector<uint32_t>& cell = shard[entry.cell];
+        entry.cellSlot = static_cast<uint32_t>(cell.size());
+        cell.push_back(i);
+      }
+      // Las celdas que quedaron vacias se liberan aqui
+      for (auto it = shard.begin(); it != shard.end();) {
+        it = it->second.empty() ? shard.erase(it) : std::next(it);
+      }
+    }
+  };
+  if (jobSystem) {
+    jobSystem->parallelFor(0, SHARD_COUNT, 1, fillShards);
+  }
+  else {
+    fillShards(0, SHARD_COUNT);
+  }
+}
+
+uint32_t
+SpatialGrid::endSync() {
+  uint32_t removed = 0;
+  for (uint32_t i = static_cast<uint32_t>(m_entries.size()); i-- > 0;) {
+    if (m_entries[i].stamp != m_syncStamp) {
+      eraseEntry(i);
+      ++removed;
+    }
+  }
+  return removed;
+}
+
+void
+SpatialGrid::queryRadius(const sf::Vector2f& center,
+                         float radius,
+                         std::vector<EntityHandle>& out) const {
+  const float radiusSq = radius * radius;
+  forEachInCells(center.x - radius, center.y - radius, center.x + radius, center.y + radius,
+                 [this, &center, radiusSq, &out](uint32_t index) {
+    const Entry& entry = m_entries[index];
+    const float dx = entry.position.x - center.x;
+    const float dy = entry.position.y - center.y;
+    if (dx * dx + dy * dy <= radiusSq) {
+      out.push_back(entry.handle);
+    }
+  });
+}
+
+void
+SpatialGrid::queryAABB(const sf::FloatRect& area, std::vector<EntityHandle>& out) const {
+  const float right = area.left + area.width;
+  const float bottom = area.top + area.height;
+  forEachInCells(area.left, area.top, right, bottom, [this, &area, right, bottom, &out](uint32_t index) {
+    const Entry& entry = m_entries[index];
+    if (entry.position.x >= area.left && entry.position.x <= right &&
+        entry.position.y >= area.top && entry.position.y <= bottom) {
+      out.push_back(entry.handle);
+    }
+  });
+}
+
+size_t
+SpatialGrid::getCellCount() const {
+  size_t count = 0;
+  for (const CellMap& shard : m_shards) {
+    count += shard.size();
+  }
+  return count;
+}
@@ -0,0 +1,73 @@
+#include "ECS/SystemScheduler.h"
+#include "ECS/ArchetypeStorage.h"
+#include "Jobs/JobSystem.h"
+#include "Utilities/Profiler.h"
+#include <algorithm>
+
+/**
+ * @file SystemScheduler.cpp
+ * @brief Implements stage building and per-phase execution of systems.
+ */
+
+void
+SystemScheduler::run(SystemPhase phase, ArchetypeStorage& storage, float deltaTime) {
+  const bool parallel = m_jobSystem != nullptr && phase != SystemPhase::RENDER;
+
+  for (auto& stage : getStages(phase)) {
+    if (!parallel || stage.size() == 1) {
+      for (System* system : stage) {
+        PROFILE_ZONE(system->getName().c_str());
+        system->run(storage, deltaTime);
+      }
+      continue;
+    }
+
+    // Sistemas sin conflictos de lectura/escritura: uno por job
+    JobCounter counter;
+    for (System* system : stage) {
+      m_jobSystem->schedule([system, &storage, deltaTime]() {
+        PROFILE_ZONE(system->getName().c_str());
+        system->run(storage, deltaTime);
+      }, &counter);
+    }
+    m_jobSystem->wait(counter);
+  }
+}
+
+const std::vector<std::vector<System*>>&
+SystemScheduler::getStages(SystemPhase phase) {
+  if (m_dirty) {
+    buildStages();
+  }
+  return m_stages[static_cast<size_t>(phase)];
+}
+
+void
+SystemScheduler::buildStages() {
+  for (auto& stages : m_stages) {
+    stages.clear();
+  }
+
+  std::vector<size_t> stageOf(m_systems.size(), 0);
+  for (size_t i = 0; i < m_systems.size(); ++i) {
+    System& system = *m_systems[i];
+
+    // Goes after every earlier system of the same phase that it conflicts with
+    size_t stage = 0;
+    for (size_t j = 0; j < i; ++j) {
+      const System& earlier = *m_systems[j];
+      if (earlier.getPhase() == system.getPhase() && system.conflictsWith(earlier)) {
+        stage = std::max(stage, stageOf[j] + 1);
+      }
+    }
+    stageOf[i] = stage;
+
+    auto& stages = m_stages[static_cast<size_t>(system.getPhase())];
+    if (stages.size() <= stage) {
+      stages.resize(stage + 1);
+    }
+    stages[stage].push_back(&system);
+  }
+
+  m_dirty = false;
+}
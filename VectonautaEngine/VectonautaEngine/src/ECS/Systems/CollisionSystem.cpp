@@ -0,0 +1,493 @@
+#include "ECS/Systems/CollisionSystem.h"
+#include "ECS/ArchetypeStorage.h"
+#include "ECS/Entity.h"
+#include "ECS/Transform.h"
+#include "Jobs/JobSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+/**
+ * @file CollisionSystem.cpp
+ * @brief Implements sweep-and-prune and the SAT/circle narrow phase.
+ */
+
+namespace {
+  /**
+   * @brief Bodies handed to each job in the parallel passes.
+   */
+  constexpr uint32_t BODIES_PER_JOB = 1024;
+
+  /**
+   * @brief Bands handed to each job in the sweep.
+   */
+  constexpr uint32_t BANDS_PER_JOB = 8;
+
+  /**
+   * @brief Upper bound on bands, so a few far-away bodies cannot blow up the band table.
+   */
+  constexpr uint32_t MAX_BANDS = 4096;
+
+  /**
+   * @brief Band height, in average body heights.
+   */
+  constexpr float BAND_HEIGHT_SCALE = 2.f;
+
+  /**
+   * @brief Degrees to radians.
+   */
+  constexpr float DEG_TO_RAD = 3.14159265358979f / 180.f;
+
+  float
+  dot(const sf::Vector2f& a, const sf::Vector2f& b) {
+    return a.x * b.x + a.y * b.y;
+  }
+
+  float
+  cross(const sf::Vector2f& a, const sf::Vector2f& b) {
+    return a.x * b.y - a.y * b.x;
+  }
+
+  float
+  length(const sf::Vector2f& v) {
+    return std::sqrt(dot(v, v));
+  }
+}
+
+CollisionSystem::CollisionSystem(JobSystem* jobSystem)
+  : System("CollisionSystem",
+           SystemPhase::UPDATE,
+           makeSignature<Transform, Collider>(),
+           ComponentSignature()),
+  m_jobSystem(jobSystem) {
+}
+
+void
+CollisionSystem::run(ArchetypeStorage& storage, float) {
+  gatherBodies(storage);
+  sortBodies();
+  fillBands();
+  findContacts();
+}
+
+void
+CollisionSystem::gatherBodies(ArchetypeStorage& storage) {
+  // 1) Copia serie de los datos de entrada y reparto del buffer de vertices
+  m_bodies.clear();
+  uint32_t vertexCount = 0;
+  storage.forEach(makeSignature<Transform, Collider>(), [this, &vertexCount](Archetype& archetype) {
+    const TransformColumns& transforms = archetype.getTransforms();
+    for (uint32_t row = 0; row < archetype.size(); ++row) {
+      const Collider* collider = archetype.getComponent<Collider>(row);
+      if (collider->getType() == ColliderType::NONE) {
+        continue;
+      }
+      Body body;
+      body.handle = archetype.getEntity(row)->getHandle();
+      body.type = collider->getType();
+      body.collider = collider;
+      body.position = transforms.positions[row];
+      body.rotation = transforms.rotations[row].x;
+      body.scale = transforms.scales[row];
+      body.firstVertex = vertexCount;
+      body.vertexCount = static_cast<uint32_t>(collider->getPoints().size());
+      vertexCount += body.vertexCount;
+      m_bodies.push_back(body);
+    }
+  });
+  m_vertices.resize(vertexCount);
+  m_normals.resize(vertexCount);
+
+  // 2) Geometria en espacio de mundo; cada cuerpo escribe solo su rango de vertices
+  auto transformBodies = [this](uint32_t first, uint32_t last) {
+    for (uint32_t i = first; i < last; ++i) {
+      computeWorldGeometry(m_bodies[i]);
+    }
+  };
+  const uint32_t count = static_cast<uint32_t>(m_bodies.size());
+  if (m_jobSystem) {
+    m_jobSystem->parallelFor(0, count, BODIES_PER_JOB, transformBodies);
+  }
+  else {
+    transformBodies(0, count);
+  }
+}
+
+void
+CollisionSystem::computeWorldGeometry(Body& body) {
+  // Igual que sf::Transformable: escala, luego rotacion, luego traslacion
+  const float angle = body.rotation * DEG_TO_RAD;
+  const float cosine = std::cos(angle);
+  const float sine = std::sin(angle);
+  auto toWorld = [&body, cosine, sine](const sf::Vector2f& local) {
+    const float x = local.x * body.scale.x;
+    const float y = local.y * body.scale.y;
+    return sf::Vector2f(body.position.x + x * cosine - y * sine,
+                        body.position.y + x * sine + y * cosine);
+  };
+
+  if (body.type == ColliderType::CIRCLE) {
+    body.center = toWorld(body.collider->getCenter());
+    body.radius = body.collider->getRadius() * std::max(std::abs(body.scale.x), std::abs(body.scale.y));
+    body.minX = body.center.x - body.radius;
+    body.maxX = body.center.x + body.radius;
+    body.minY = body.center.y - body.radius;
+    body.maxY = body.center.y + body.radius;
+    return;
+  }
+
+  const std::vector<sf::Vector2f>& points = body.collider->getPoints();
+  sf::Vector2f* vertices = m_vertices.data() + body.firstVertex;
+  sf::Vector2f* normals = m_normals.data() + body.firstVertex;
+  const uint32_t n = body.vertexCount;
+  float area = 0.f;
+  body.minX = body.minY = std::numeric_limits<float>::max();
+  body.maxX = body.maxY = std::numeric_limits<float>::lowest();
+  for (uint32_t i = 0; i < n; ++i) {
+    vertices[i] = toWorld(points[i]);
+    body.minX = std::min(body.minX, vertices[i].x);
+    body.maxX = std::max(body.maxX, vertices[i].x);
+    body.minY = std::min(body.minY, vertices[i].y);
+    body.maxY = std::max(body.maxY, vertices[i].y);
+  }
+  for (uint32_t i = 0; i < n; ++i) {
+    area += cross(vertices[i], vertices[(i + 1) % n]);
+  }
+
+  // La normal hacia afuera depende del sentido de giro (y de una escala negativa)
+  const float side = area >= 0.f ? 1.f : -1.f;
+  for (uint32_t i = 0; i < n; ++i) {
+    const sf::Vector2f edge = vertices[(i + 1) % n] - vertices[i];
+    const float edgeLength = length(edge);
+    normals[i] = edgeLength > 0.f
+      ? sf::Vector2f(edge.y, -edge.x) * (side / edgeLength)
+      : sf::Vector2f(0.f, 0.f);
+  }
+  body.center = vertices[0];
+  body.radius = 0.f;
+}
+
+void
+CollisionSystem::sortBodies() {
+  const uint32_t count = static_cast<uint32_t>(m_bodies.size());
+  auto byMinX = [this](uint32_t a, uint32_t b) { return m_bodies[a].minX < m_bodies[b].minX; };
+
+  if (m_order.size() != count) {
+    m_order.resize(count);
+    std::iota(m_order.begin(), m_order.end(), 0u);
+    std::sort(m_order.begin(), m_order.end(), byMinX);
+  }
+  else {
+    // Orden del tick anterior: casi ordenado, la insercion es casi lineal
+    for (uint32_t i = 1; i < count; ++i) {
+      const uint32_t index = m_order[i];
+      uint32_t j = i;
+      while (j > 0 && byMinX(index, m_order[j - 1])) {
+        m_order[j] = m_order[j - 1];
+        --j;
+      }
+      m_order[j] = index;
+    }
+  }
+}
+
+void
+CollisionSystem::fillBands() {
+  const uint32_t count = static_cast<uint32_t>(m_bodies.size());
+  m_bandCount = 1;
+  m_bandStart.assign(2, 0);
+  m_sweep.clear();
+  if (count == 0) {
+    return;
+  }
+
+  // Altura de banda a partir del alto medio de los cuerpos
+  float top = std::numeric_limits<float>::max();
+  float bottom = std::numeric_limits<float>::lowest();
+  float totalHeight = 0.f;
+  for (const Body& body : m_bodies) {
+    top = std::min(top, body.minY);
+    bottom = std::max(bottom, body.maxY);
+    totalHeight += body.maxY - body.minY;
+  }
+  const float range = std::max(bottom - top, 1.f);
+  const float bandHeight = std::max({ BAND_HEIGHT_SCALE * totalHeight / float(count),
+                                      range / float(MAX_BANDS),
+                                      1e-3f });
+  const uint32_t bandCount = std::min(MAX_BANDS, static_cast<uint32_t>(range / bandHeight) + 1);
+  m_bandCount = bandCount;
+  m_bandTop = top;
+  m_invBandHeight = 1.f / bandHeight;
+
+  // Reparto estable en el orden por minX: cada banda queda ordenada sin volver a ordenar
+  m_bandStart.assign(bandCount + 1, 0);
+  for (const Body& body : m_bodies) {
+    for (uint32_t band = bandOf(body.minY), last = bandOf(body.maxY); band <= last; ++band) {
+      ++m_bandStart[band + 1];
+    }
+  }
+  for (uint32_t band = 0; band < bandCount; ++band) {
+    m_bandStart[band + 1] += m_bandStart[band];
+  }
+  m_sweep.resize(m_bandStart[bandCount]);
+  m_bandCursor.assign(m_bandStart.begin(), m_bandStart.end() - 1);
+  for (uint32_t index : m_order) {
+    const Body& body = m_bodies[index];
+    const SweepBox box = { body.minX, body.maxX, body.minY, body.maxY, index };
+    for (uint32_t band = bandOf(body.minY), last = bandOf(body.maxY); band <= last; ++band) {
+      m_sweep[m_bandCursor[band]++] = box;
+    }
+  }
+}
+
+void
+CollisionSystem::findContacts() {
+  const uint32_t bandCount = static_cast<uint32_t>(m_bandStart.size() - 1);
+  const uint32_t chunkCount = (bandCount + BANDS_PER_JOB - 1) / BANDS_PER_JOB;
+  m_chunkContacts.resize(std::max<size_t>(m_chunkContacts.size(), chunkCount));
+  m_chunkPairs.assign(chunkCount, 0);
+
+  // Cada banda se barre por separado; un par solo cuenta en la banda donde empieza su solape
+  auto sweepChunks = [this, bandCount](uint32_t firstChunk, uint32_t lastChunk) {
+    for (uint32_t chunk = firstChunk; chunk < lastChunk; ++chunk) {
+      std::vector<ContactManifold>& contacts = m_chunkContacts[chunk];
+      contacts.clear();
+      uint64_t pairs = 0;
+      const uint32_t lastBand = std::min(bandCount, (chunk + 1) * BANDS_PER_JOB);
+      for (uint32_t band = chunk * BANDS_PER_JOB; band < lastBand; ++band) {
+        const uint32_t end = m_bandStart[band + 1];
+        for (uint32_t i = m_bandStart[band]; i < end; ++i) {
+          const SweepBox& box = m_sweep[i];
+          for (uint32_t j = i + 1; j < end && m_sweep[j].minX <= box.maxX; ++j) {
+            const SweepBox& other = m_sweep[j];
+            if (other.minY > box.maxY || other.maxY < box.minY) {
+              continue;
+            }
+            if (bandOf(std::max(box.minY, other.minY)) != band) {
+              continue;
+            }
+            ++pairs;
+            ContactManifold manifold;
+            if (collide(m_bodies[box.body], m_bodies[other.body], manifold)) {
+              contacts.push_back(manifold);
+            }
+          }
+        }
+      }
+      m_chunkPairs[chunk] = pairs;
+    }
+  };
+  if (m_jobSystem) {
+    m_jobSystem->parallelFor(0, chunkCount, 1, sweepChunks);
+  }
+  else {
+    sweepChunks(0, chunkCount);
+  }
+
+  m_contacts.clear();
+  m_pairCount = 0;
+  for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+    m_contacts.insert(m_contacts.end(), m_chunkContacts[chunk].begin(), m_chunkContacts[chunk].end());
+    m_pairCount += m_chunkPairs[chunk];
+  }
+}
+
+bool
+CollisionSystem::collide(const Body& a, const Body& b, ContactManifold& manifold) const {
+  bool hit = false;
+  if (a.type == ColliderType::CIRCLE && b.type == ColliderType::CIRCLE) {
+    hit = collideCircles(a, b, manifold);
+  }
+  else if (a.type == ColliderType::POLYGON && b.type == ColliderType::POLYGON) {
+    hit = collidePolygons(a, b, manifold);
+  }
+  else if (a.type == ColliderType::POLYGON) {
+    hit = collidePolygonCircle(a, b, manifold);
+  }
+  else {
+    hit = collidePolygonCircle(b, a, manifold);
+    manifold.normal = -manifold.normal;
+  }
+  manifold.a = a.handle;
+  manifold.b = b.handle;
+  return hit;
+}
+
+bool
+CollisionSystem::collideCircles(const Body& a, const Body& b, ContactManifold& manifold) const {
+  const sf::Vector2f delta = b.center - a.center;
+  const float radii = a.radius + b.radius;
+  const float distanceSq = dot(delta, delta);
+  if (distanceSq > radii * radii) {
+    return false;
+  }
+  const float distance = std::sqrt(distanceSq);
+  manifold.normal = distance > 0.f ? delta / distance : sf::Vector2f(1.f, 0.f);
+  manifold.depth = radii - distance;
+  manifold.pointCount = 1;
+  manifold.points[0] = a.center + manifold.normal * (a.radius - manifold.depth * 0.5f);
+  return true;
+}
+
+bool
+CollisionSystem::collidePolygonCircle(const Body& polygon,
+                                      const Body& circle,
+                                      ContactManifold& manifold) const {
+  const sf::Vector2f* vertices = m_vertices.data() + polygon.firstVertex;
+  const sf::Vector2f* normals = m_normals.data() + polygon.firstVertex;
+  const uint32_t n = polygon.vertexCount;
+
+  // Arista de separacion maxima
+  float separation = std::numeric_limits<float>::lowest();
+  uint32_t edge = 0;
+  for (uint32_t i = 0; i < n; ++i) {
+    const float s = dot(normals[i], circle.center - vertices[i]);
+    if (s > circle.radius) {
+      return false;
+    }
+    if (s > separation) {
+      separation = s;
+      edge = i;
+    }
+  }
+
+  const sf::Vector2f& v1 = vertices[edge];
+  const sf::Vector2f& v2 = vertices[(edge + 1) % n];
+  manifold.pointCount = 1;
+  if (separation <= 0.f) {
+    // Centro dentro del poligono
+    manifold.normal = normals[edge];
+    manifold.depth = circle.radius - separation;
+    manifold.points[0] = circle.center - normals[edge] * separation;
+    return true;
+  }
+
+  // Region de Voronoi: vertice v1, vertice v2 o la arista
+  const sf::Vector2f* corner = nullptr;
+  if (dot(circle.center - v1, v2 - v1) <= 0.f) {
+    corner = &v1;
+  }
+  else if (dot(circle.center - v2, v1 - v2) <= 0.f) {
+    corner = &v2;
+  }
+  if (corner != nullptr) {
+    const sf::Vector2f delta = circle.center - *corner;
+    const float distance = length(delta);
+    if (distance > circle.radius) {
+      return false;
+    }
+    manifold.normal = distance > 0.f ? delta / distance : normals[edge];
+    manifold.depth = circle.radius - distance;
+    manifold.points[0] = *corner;
+    return true;
+  }
+
+  manifold.normal = normals[edge];
+  manifold.depth = circle.radius - separation;
+  manifold.points[0] = circle.center - normals[edge] * separation;
+  return true;
+}
+
+float
+CollisionSystem::findMaxSeparation(const Body& a, const Body& b, uint32_t& edge) const {
+  const sf::Vector2f* verticesA = m_vertices.data() + a.firstVertex;
+  const sf::Vector2f* normalsA = m_normals.data() + a.firstVertex;
+  const sf::Vector2f* verticesB = m_vertices.data() + b.firstVertex;
+  float best = std::numeric_limits<float>::lowest();
+  edge = 0;
+  for (uint32_t i = 0; i < a.vertexCount; ++i) {
+    float deepest = std::numeric_limits<float>::max();
+    for (uint32_t j = 0; j < b.vertexCount; ++j) {
+      deepest = std::min(deepest, dot(normalsA[i], verticesB[j] - verticesA[i]));
+    }
+    if (deepest > best) {
+      best = deepest;
+      edge = i;
+      if (best > 0.f) {
+        break;
+      }
+    }
+  }
+  return best;
+}
+
+bool
+CollisionSystem::collidePolygons(const Body& a, const Body& b, ContactManifold& manifold) const {
+  uint32_t edgeA = 0;
+  const float separationA = findMaxSeparation(a, b, edgeA);
+  if (separationA > 0.f) {
+    return false;
+  }
+  uint32_t edgeB = 0;
+  const float separationB = findMaxSeparation(b, a, edgeB);
+  if (separationB > 0.f) {
+    return false;
+  }
+
+  // La cara de referencia es la de menor penetracion; se prefiere A ante empates
+  const bool flip = separationB > separationA + 0.001f;
+  const Body& reference = flip ? b : a;
+  const Body& incident = flip ? a : b;
+  const uint32_t referenceEdge = flip ? edgeB : edgeA;
+
+  const sf::Vector2f* refVertices = m_vertices.data() + reference.firstVertex;
+  const sf::Vector2f& normal = m_normals[reference.firstVertex + referenceEdge];
+  const sf::Vector2f v1 = refVertices[referenceEdge];
+  const sf::Vector2f v2 = refVertices[(referenceEdge + 1) % reference.vertexCount];
+
+  // Arista incidente: la mas opuesta a la normal de referencia
+  const sf::Vector2f* incVertices = m_vertices.data() + incident.firstVertex;
+  const sf::Vector2f* incNormals = m_normals.data() + incident.firstVertex;
+  uint32_t incidentEdge = 0;
+  float minDot = std::numeric_limits<float>::max();
+  for (uint32_t i = 0; i < incident.vertexCount; ++i) {
+    const float d = dot(normal, incNormals[i]);
+    if (d < minDot) {
+      minDot = d;
+      incidentEdge = i;
+    }
+  }
+  sf::Vector2f clip[2] = {
+    incVertices[incidentEdge],
+    incVertices[(incidentEdge + 1) % incident.vertexCount]
+  };
+
+  // Recorte de la arista incidente contra los lados de la arista de referencia
+  const sf::Vector2f tangentRaw = v2 - v1;
+  const float tangentLength = length(tangentRaw);
+  const sf::Vector2f tangent = tangentLength > 0.f ? tangentRaw / tangentLength : sf::Vector2f(0.f, 0.f);
+  auto clipSegment = [&clip](const sf::Vector2f& planeNormal, float offset) {
+    const float d0 = dot(planeNormal, clip[0]) - offset;
+    const float d1 = dot(planeNormal, clip[1]) - offset;
+    if (d0 > 0.f && d1 > 0.f) {
+      return false;
+    }
+    if (d0 > 0.f) {
+      clip[0] = clip[0] + (clip[1] - clip[0]) * (d0 / (d0 - d1));
+    }
+    else if (d1 > 0.f) {
+      clip[1] = clip[1] + (clip[0] - clip[1]) * (d1 / (d1 - d0));
+    }
+    return true;
+  };
+  if (!clipSegment(-tangent, -dot(tangent, v1)) || !clipSegment(tangent, dot(tangent, v2))) {
+    return false;
+  }
+
+  // Puntos por debajo de la cara de referencia
+  manifold.pointCount = 0;
+  manifold.depth = 0.f;
+  for (const sf::Vector2f& point : clip) {
+    const float separation = dot(normal, point - v1);
+    if (separation <= 0.f) {
+      manifold.points[manifold.pointCount++] = point;
+      manifold.depth = std::max(manifold.depth, -separation);
+    }
+  }
+  if (manifold.pointCount == 0) {
+    return false;
+  }
+  manifold.normal = flip ? -normal : normal;
+  return true;
+}
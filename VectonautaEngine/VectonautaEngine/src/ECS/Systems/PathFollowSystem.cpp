@@ -0,0 +1,47 @@
+#include "ECS/Systems/PathFollowSystem.h"
+#include "ECS/ArchetypeStorage.h"
+#include "ECS/PathFollower.h"
+#include "ECS/Transform.h"
+#include "Jobs/JobSystem.h"
+
+/**
+ * @file PathFollowSystem.cpp
+ * @brief Implements the batched path following pass.
+ */
+
+namespace {
+  /**
+   * @brief Rows handed to each job when the pass runs in parallel.
+   */
+  constexpr uint32_t ROWS_PER_JOB = 512;
+}
+
+PathFollowSystem::PathFollowSystem(JobSystem* jobSystem)
+  : System("PathFollowSystem",
+           SystemPhase::UPDATE,
+           ComponentSignature(),
+           makeSignature<PathFollower, Transform>()),
+  m_jobSystem(jobSystem) {
+}
+
+void
+PathFollowSystem::run(ArchetypeStorage& storage, float deltaTime) {
+  storage.forEach(makeSignature<Transform, PathFollower>(), [this, deltaTime](Archetype& archetype) {
+    sf::Vector2f* positions = archetype.getTransforms().positions.data();
+    auto followRows = [&archetype, positions, deltaTime](uint32_t first, uint32_t last) {
+      for (uint32_t row = first; row < last; ++row) {
+        PathFollower* follower = archetype.getComponent<PathFollower>(row);
+        if (follower->getPath()) {
+          positions[row] = follower->advance(deltaTime);
+        }
+      }
+    };
+
+    if (m_jobSystem) {
+      m_jobSystem->parallelFor(0, archetype.size(), ROWS_PER_JOB, followRows);
+    }
+    else {
+      followRows(0, archetype.size());
+    }
+  });
+}
@@ -0,0 +1,55 @@
+#include "ECS/Systems/RenderSystem.h"
+#include "ECS/ArchetypeStorage.h"
+#include "ECS/Entity.h"
+#include "CShape.h"
+#include "Window.h"
+#include <algorithm>
+
+/**
+ * @file RenderSystem.cpp
+ * @brief Implements drawing of all stored shapes.
+ */
+
+RenderSystem::RenderSystem(const EngineUtilities::TSharedPointer<Window>& window,
+                           EngineUtilities::FrameArena& frameArena)
+  : System("RenderSystem",
+           SystemPhase::RENDER,
+           makeSignature<CShape>(),
+           ComponentSignature()),
+  m_window(window),
+  m_frameArena(frameArena),
+  m_batch(frameArena) {
+}
+
+void
+RenderSystem::run(ArchetypeStorage& storage, float /*deltaTime*/) {
+  Window& window = *m_window;
+
+  // Las filas siguen el orden en que se crearon los arquetipos; se ordena por entidad
+  EngineUtilities::TFrameVector<DrawItem> items{
+    EngineUtilities::TFrameAllocator<DrawItem>(m_frameArena) };
+  items.reserve(m_drawReserve);
+  storage.forEach(makeSignature<CShape>(), [&items](Archetype& archetype) {
+    const uint32_t count = archetype.size();
+    for (uint32_t row = 0; row < count; ++row) {
+      CShape* shape = archetype.getComponent<CShape>(row);
+      if (sf::Shape* sfShape = shape->getShape()) {
+        items.push_back({ archetype.getEntity(row)->getHandle().getIndex(), sfShape });
+      }
+    }
+  });
+  m_drawReserve = std::max(m_drawReserve, items.size());
+
+  auto byEntity = [](const DrawItem& a, const DrawItem& b) {
+    return a.entityIndex < b.entityIndex;
+  };
+  if (!std::is_sorted(items.begin(), items.end(), byEntity)) {
+    std::sort(items.begin(), items.end(), byEntity);
+  }
+
+  m_batch.begin();
+  for (const DrawItem& item : items) {
+    m_batch.add(*item.shape, window);
+  }
+  m_batch.flush(window);
+}
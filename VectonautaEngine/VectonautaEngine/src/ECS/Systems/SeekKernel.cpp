@@ -0,0 +1,243 @@
+#include "ECS/Systems/SeekKernel.h"
+#include "ECS/Transform.h"
+#include <algorithm>
+#include <chrono>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define VECTONAUTA_SEEK_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define VECTONAUTA_TARGET_AVX
+#else
+#include <cpuid.h>
+#define VECTONAUTA_TARGET_AVX __attribute__((target("avx")))
+#endif
+#endif
+
+/**
+ * @file SeekKernel.cpp
+ * @brief Implements the seek kernels and run-time CPU detection.
+ */
+
+static_assert(sizeof(sf::Vector2f) == 2 * sizeof(float),
+              "SeekKernel reads sf::Vector2f arrays as interleaved floats");
+
+void
+SeekKernel::seekScalar(sf::Vector2f* positions,
+                       const sf::Vector2f* targets,
+                       const float* speeds,
+                       const float* ranges,
+                       uint32_t count,
+                       float deltaTime) {
+  for (uint32_t i = 0; i < count; ++i) {
+    Transform::seekStep(positions[i], targets[i], speeds[i], deltaTime, ranges[i]);
+  }
+}
+
+#ifdef VECTONAUTA_SEEK_X86
+namespace {
+  /**
+   * @brief SSE path: 4 agents per iteration, the rest through the scalar path.
+   */
+  void
+  seekSSE(sf::Vector2f* positions,
+          const sf::Vector2f* targets,
+          const float* speeds,
+          const float* ranges,
+          uint32_t count,
+          float deltaTime) {
+    float* position = reinterpret_cast<float*>(positions);
+    const float* target = reinterpret_cast<const float*>(targets);
+    const __m128 dt = _mm_set1_ps(deltaTime);
+
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+      // x0 y0 x1 y1 | x2 y2 x3 y3 -> x0 x1 x2 x3 / y0 y1 y2 y3
+      const __m128 p01 = _mm_loadu_ps(position + 2 * i);
+      const __m128 p23 = _mm_loadu_ps(position + 2 * i + 4);
+      const __m128 t01 = _mm_loadu_ps(target + 2 * i);
+      const __m128 t23 = _mm_loadu_ps(target + 2 * i + 4);
+      const __m128 px = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m128 py = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m128 tx = _mm_shuffle_ps(t01, t23, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m128 ty = _mm_shuffle_ps(t01, t23, _MM_SHUFFLE(3, 1, 3, 1));
+
+      const __m128 dx = _mm_sub_ps(tx, px);
+      const __m128 dy = _mm_sub_ps(ty, py);
+      const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+      const __m128 moving = _mm_cmpgt_ps(length, _mm_loadu_ps(ranges + i));
+
+      // Mismo orden que seekStep: (d / len) * speed * dt
+      const __m128 speed = _mm_loadu_ps(speeds + i);
+      const __m128 stepX = _mm_mul_ps(_mm_mul_ps(_mm_div_ps(dx, length), speed), dt);
+      const __m128 stepY = _mm_mul_ps(_mm_mul_ps(_mm_div_ps(dy, length), speed), dt);
+
+      // Los que ya llegaron conservan su valor exacto (como la rama de seekStep)
+      const __m128 rx = _mm_or_ps(_mm_and_ps(moving, _mm_add_ps(px, stepX)),
+                                  _mm_andnot_ps(moving, px));
+      const __m128 ry = _mm_or_ps(_mm_and_ps(moving, _mm_add_ps(py, stepY)),
+                                  _mm_andnot_ps(moving, py));
+      _mm_storeu_ps(position + 2 * i, _mm_unpacklo_ps(rx, ry));
+      _mm_storeu_ps(position + 2 * i + 4, _mm_unpackhi_ps(rx, ry));
+    }
+
+    SeekKernel::seekScalar(positions + i, targets + i, speeds + i, ranges + i, count - i, deltaTime);
+  }
+
+  /**
+   * @brief AVX path: 8 agents per iteration, the rest through the SSE path.
+   */
+  VECTONAUTA_TARGET_AVX void
+  seekAVX(sf::Vector2f* positions,
+          const sf::Vector2f* targets,
+          const float* speeds,
+          const float* ranges,
+          uint32_t count,
+          float deltaTime) {
+    float* position = reinterpret_cast<float*>(positions);
+    const float* target = reinterpret_cast<const float*>(targets);
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+      // Reordenamos las mitades para que el shuffle por carriles deje x0..x7 en orden
+      const __m256 pa = _mm256_loadu_ps(position + 2 * i);
+      const __m256 pb = _mm256_loadu_ps(position + 2 * i + 8);
+      const __m256 ta = _mm256_loadu_ps(target + 2 * i);
+      const __m256 tb = _mm256_loadu_ps(target + 2 * i + 8);
+      const __m256 p0 = _mm256_permute2f128_ps(pa, pb, 0x20);
+      const __m256 p1 = _mm256_permute2f128_ps(pa, pb, 0x31);
+      const __m256 t0 = _mm256_permute2f128_ps(ta, tb, 0x20);
+      const __m256 t1 = _mm256_permute2f128_ps(ta, tb, 0x31);
+      const __m256 px = _mm256_shuffle_ps(p0, p1, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 py = _mm256_shuffle_ps(p0, p1, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 tx = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 ty = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 1, 3, 1));
+
+      const __m256 dx = _mm256_sub_ps(tx, px);
+      const __m256 dy = _mm256_sub_ps(ty, py);
+      const __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx),
+                                                         _mm256_mul_ps(dy, dy)));
+      const __m256 moving = _mm256_cmp_ps(length, _mm256_loadu_ps(ranges + i), _CMP_GT_OQ);
+
+      const __m256 speed = _mm256_loadu_ps(speeds + i);
+      const __m256 stepX = _mm256_mul_ps(_mm256_mul_ps(_mm256_div_ps(dx, length), speed), dt);
+      const __m256 stepY = _mm256_mul_ps(_mm256_mul_ps(_mm256_div_ps(dy, length), speed), dt);
+      const __m256 rx = _mm256_blendv_ps(px, _mm256_add_ps(px, stepX), moving);
+      const __m256 ry = _mm256_blendv_ps(py, _mm256_add_ps(py, stepY), moving);
+
+      const __m256 lo = _mm256_unpacklo_ps(rx, ry);
+      const __m256 hi = _mm256_unpackhi_ps(rx, ry);
+      _mm256_storeu_ps(position + 2 * i, _mm256_permute2f128_ps(lo, hi, 0x20));
+      _mm256_storeu_ps(position + 2 * i + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+    seekSSE(positions + i, targets + i, speeds + i, ranges + i, count - i, deltaTime);
+  }
+
+  /**
+   * @brief Checks that the CPU has AVX and the OS saves the YMM registers.
+   */
+  bool
+  cpuHasAVX() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    const unsigned ecx = static_cast<unsigned>(info[2]);
+#else
+    unsigned eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+      return false;
+    }
+#endif
+    const bool osxsave = (ecx & (1u << 27)) != 0;
+    const bool avx = (ecx & (1u << 28)) != 0;
+    if (!osxsave || !avx) {
+      return false;
+    }
+#if defined(_MSC_VER)
+    const unsigned long long xcr0 = _xgetbv(0);
+#else
+    unsigned xcrLow, xcrHigh;
+    __asm__ volatile("xgetbv" : "=a"(xcrLow), "=d"(xcrHigh) : "c"(0));
+    const unsigned long long xcr0 = (static_cast<unsigned long long>(xcrHigh) << 32) | xcrLow;
+#endif
+    // Bits 1 (XMM) y 2 (YMM): el sistema guarda los registros en los cambios de contexto
+    return (xcr0 & 0x6) == 0x6;
+  }
+}
+#endif
+
+SeekKernel::Path
+SeekKernel::detect() {
+#ifdef VECTONAUTA_SEEK_X86
+  static const Path path = cpuHasAVX() ? Path::AVX : Path::SSE;
+  return path;
+#else
+  return Path::SCALAR;
+#endif
+}
+
+SeekKernel::Path
+SeekKernel::choose() {
+  static const Path path = []() {
+    const Path widest = detect();
+    if (widest != Path::AVX) {
+      return widest;
+    }
+
+    // Lote sintetico: mitad de agentes en movimiento, mitad ya llegados
+    constexpr uint32_t AGENTS = 4096;
+    constexpr int REPEATS = 8;
+    std::vector<sf::Vector2f> targets(AGENTS);
+    std::vector<float> speeds(AGENTS, 100.f);
+    std::vector<float> ranges(AGENTS, 1.f);
+    for (uint32_t i = 0; i < AGENTS; ++i) {
+      targets[i] = sf::Vector2f(float(i % 97) * 13.f, float(i % 89) * 7.f);
+    }
+    auto timePath = [&](Path candidate) {
+      Function kernel = get(candidate);
+      std::vector<sf::Vector2f> positions(AGENTS, sf::Vector2f(0.f, 0.f));
+      double best = 1e30;
+      for (int repeat = 0; repeat < REPEATS; ++repeat) {
+        const auto start = std::chrono::steady_clock::now();
+        kernel(positions.data(), targets.data(), speeds.data(), ranges.data(), AGENTS, 1.f / 60.f);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+      }
+      return best;
+    };
+    return timePath(Path::AVX) < timePath(Path::SSE) ? Path::AVX : Path::SSE;
+  }();
+  return path;
+}
+
+SeekKernel::Function
+SeekKernel::get(Path path) {
+#ifdef VECTONAUTA_SEEK_X86
+  switch (path) {
+  case Path::AVX:
+    return cpuHasAVX() ? &seekAVX : &seekSSE;
+  case Path::SSE:
+    return &seekSSE;
+  default:
+    break;
+  }
+#else
+  (void)path;
+#endif
+  return &SeekKernel::seekScalar;
+}
+
+const char*
+SeekKernel::getName(Path path) {
+  switch (path) {
+  case Path::AVX:
+    return "AVX";
+  case Path::SSE:
+    return "SSE";
+  default:
+    return "Scalar";
+  }
+}
@@ -0,0 +1,62 @@
+#include "ECS/Systems/SeekSystem.h"
+#include "ECS/ArchetypeStorage.h"
+#include "ECS/SeekTarget.h"
+#include "ECS/Transform.h"
+#include "Jobs/JobSystem.h"
+
+/**
+ * @file SeekSystem.cpp
+ * @brief Implements the batched seek steering pass.
+ */
+
+namespace {
+  /**
+   * @brief Rows handed to each job when the pass runs in parallel.
+   */
+  constexpr uint32_t ROWS_PER_JOB = 512;
+}
+
+SeekSystem::SeekSystem(JobSystem* jobSystem)
+  : System("SeekSystem",
+           SystemPhase::UPDATE,
+           makeSignature<SeekTarget>(),
+           makeSignature<Transform>()),
+  m_jobSystem(jobSystem),
+  m_kernel(nullptr) {
+}
+
+void
+SeekSystem::run(ArchetypeStorage& storage, float deltaTime) {
+  storage.forEach(makeSignature<Transform, SeekTarget>(), [this, deltaTime](Archetype& archetype) {
+    sf::Vector2f* positions = archetype.getTransforms().positions.data();
+    if (!m_kernel) {
+      // Se elige (y se cronometra) la primera vez que hay filas, no al arrancar
+      m_kernel = SeekKernel::select();
+    }
+    SeekKernel::Function kernel = m_kernel;
+    auto seekRows = [&archetype, positions, deltaTime, kernel](uint32_t first, uint32_t last) {
+      // Buffers por hilo para no reservar memoria en cada lote
+      thread_local std::vector<sf::Vector2f> targets;
+      thread_local std::vector<float> speeds;
+      thread_local std::vector<float> ranges;
+      const uint32_t count = last - first;
+      targets.resize(count);
+      speeds.resize(count);
+      ranges.resize(count);
+      for (uint32_t i = 0; i < count; ++i) {
+        const SeekTarget* seek = archetype.getComponent<SeekTarget>(first + i);
+        targets[i] = seek->getTarget();
+        speeds[i] = seek->getSpeed();
+        ranges[i] = seek->getRange();
+      }
+      kernel(positions + first, targets.data(), speeds.data(), ranges.data(), count, deltaTime);
+    };
+
+    if (m_jobSystem) {
+      m_jobSystem->parallelFor(0, archetype.size(), ROWS_PER_JOB, seekRows);
+    }
+    else {
+      seekRows(0, archetype.size());
+    }
+  });
+}
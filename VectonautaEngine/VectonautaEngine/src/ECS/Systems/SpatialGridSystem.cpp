@@ -0,0 +1,56 @@
+#include "ECS/Systems/SpatialGridSystem.h"
+#include "ECS/ArchetypeStorage.h"
+#include "ECS/Entity.h"
+#include "ECS/Transform.h"
+#include <chrono>
+
+/**
+ * @file SpatialGridSystem.cpp
+ * @brief Implements the per-tick spatial grid sync.
+ */
+
+SpatialGridSystem::SpatialGridSystem(JobSystem* jobSystem, float cellSize)
+  : System("SpatialGridSystem",
+           SystemPhase::UPDATE,
+           makeSignature<Transform>(),
+           ComponentSignature()),
+  m_jobSystem(jobSystem),
+  m_grid(cellSize) {
+}
+
+void
+SpatialGridSystem::run(ArchetypeStorage& storage, float) {
+  m_handles.clear();
+  m_positions.clear();
+  storage.forEach(makeSignature<Transform>(), [this](Archetype& archetype) {
+    const sf::Vector2f* positions = archetype.getTransforms().positions.data();
+    for (uint32_t row = 0; row < archetype.size(); ++row) {
+      const EntityHandle handle = archetype.getEntity(row)->getHandle();
+      if (handle.isValid()) {
+        m_handles.push_back(handle);
+        m_positions.push_back(positions[row]);
+      }
+    }
+  });
+
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point start = Clock::now();
+  const uint32_t count = static_cast<uint32_t>(m_handles.size());
+  const uint32_t stored = m_grid.size();
+  const uint32_t change = count > stored ? count - stored : stored - count;
+  if (stored == 0 || change > count / 4) {
+    // Muchas altas o bajas: reconstruir en paralelo sale mas barato
+    m_grid.rebuild(m_handles.data(), m_positions.data(), count, m_jobSystem);
+    ++m_stats.rebuilds;
+    m_stats.rebuildSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+    return;
+  }
+
+  m_grid.beginSync();
+  for (uint32_t i = 0; i < count; ++i) {
+    m_grid.insert(m_handles[i], m_positions[i]);
+  }
+  m_grid.endSync();
+  ++m_stats.syncs;
+  m_stats.syncSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+}
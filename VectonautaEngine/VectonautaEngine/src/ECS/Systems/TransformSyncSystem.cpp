@@ -0,0 +1,74 @@
+#include "ECS/Systems/TransformSyncSystem.h"
+#include "ECS/ArchetypeStorage.h"
+#include "ECS/Transform.h"
+#include "CShape.h"
+#include "Jobs/JobSystem.h"
+#include <cmath>
+
+/**
+ * @file TransformSyncSystem.cpp
+ * @brief Implements the batched, interpolated Transform -> CShape copy.
+ */
+
+namespace {
+  /**
+   * @brief Rows handed to each job when the pass runs in parallel.
+   */
+  constexpr uint32_t ROWS_PER_JOB = 256;
+
+  /**
+   * @brief Returns to - from wrapped into [-180, 180), the shortest turn between two angles.
+   * @param from Start angle in degrees.
+   * @param to End angle in degrees.
+   */
+  float
+  shortestAngleDelta(float from, float to) {
+    float delta = std::fmod(to - from + 180.f, 360.f);
+    if (delta < 0.f) {
+      delta += 360.f;
+    }
+    return delta - 180.f;
+  }
+}
+
+TransformSyncSystem::TransformSyncSystem(JobSystem* jobSystem)
+  : System("TransformSyncSystem",
+           SystemPhase::RENDER,
+           makeSignature<Transform>(),
+           makeSignature<CShape>()),
+  m_jobSystem(jobSystem) {
+}
+
+void
+TransformSyncSystem::run(ArchetypeStorage& storage, float /*deltaTime*/) {
+  storage.forEach(makeSignature<Transform, CShape>(), [this](Archetype& archetype) {
+    const TransformColumns& transforms = archetype.getTransforms();
+    const float alpha = m_alpha;
+    // Cada fila toca solo su propio sf::Shape, asi que los bloques son independientes
+    auto syncRows = [&archetype, &transforms, alpha](uint32_t first, uint32_t last) {
+      for (uint32_t row = first; row < last; ++row) {
+        CShape* shape = archetype.getComponent<CShape>(row);
+        if (sf::Shape* sfShape = shape->getShape()) {
+          // Estado dibujado = anterior + (actual - anterior) * alpha
+          const sf::Vector2f& position = transforms.positions[row];
+          const sf::Vector2f& previousPosition = transforms.previousPositions[row];
+          const sf::Vector2f& scale = transforms.scales[row];
+          const sf::Vector2f& previousScale = transforms.previousScales[row];
+          const float rotation = transforms.rotations[row].x;
+          const float previousRotation = transforms.previousRotations[row].x;
+          sfShape->setPosition(previousPosition + (position - previousPosition) * alpha);
+          // El giro va por el camino corto: de 350 a 10 grados pasa por 0, no por 180
+          sfShape->setRotation(previousRotation + shortestAngleDelta(previousRotation, rotation) * alpha);
+          sfShape->setScale(previousScale + (scale - previousScale) * alpha);
+        }
+      }
+    };
+
+    if (m_jobSystem) {
+      m_jobSystem->parallelFor(0, archetype.size(), ROWS_PER_JOB, syncRows);
+    }
+    else {
+      syncRows(0, archetype.size());
+    }
+  });
+}
@@ -0,0 +1,136 @@
+#include "Jobs/JobSystem.h"
+#include "Utilities/Profiler.h"
+
+/**
+ * @file JobSystem.cpp
+ * @brief Implements worker threads, work stealing and counter waits.
+ */
+
+namespace {
+  /**
+   * @brief Job system the calling thread works for, and its queue index there.
+   */
+  thread_local const JobSystem* t_jobSystem = nullptr;
+  thread_local uint32_t t_queueIndex = 0;
+}
+
+JobSystem::JobSystem(uint32_t workerCount) {
+  if (workerCount == 0) {
+    const uint32_t hardware = std::thread::hardware_concurrency();
+    workerCount = hardware > 1 ? hardware - 1 : 1;
+  }
+
+  m_queues.reserve(workerCount + 1);
+  for (uint32_t i = 0; i < workerCount + 1; ++i) {
+    m_queues.push_back(EngineUtilities::TUniquePtr<WorkQueue>(new WorkQueue()));
+  }
+
+  m_workers.reserve(workerCount);
+  for (uint32_t i = 0; i < workerCount; ++i) {
+    m_workers.emplace_back(&JobSystem::workerLoop, this, i + 1);
+  }
+}
+
+JobSystem::~JobSystem() {
+  {
+    std::lock_guard<std::mutex> lock(m_sleepMutex);
+    m_running.store(false);
+  }
+  m_wakeCondition.notify_all();
+  for (auto& worker : m_workers) {
+    worker.join();
+  }
+}
+
+void
+JobSystem::schedule(Job job, JobCounter* counter) {
+  if (counter) {
+    counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+    job = [inner = std::move(job), counter]() {
+      inner();
+      counter->m_pending.fetch_sub(1, std::memory_order_release);
+    };
+  }
+
+  WorkQueue& queue = *m_queues[currentQueue()];
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.jobs.push_back(std::move(job));
+  }
+  m_queuedJobs.fetch_add(1, std::memory_order_release);
+
+  // Tomar el mutex evita perder el aviso si un worker esta a punto de dormir
+  { std::lock_guard<std::mutex> lock(m_sleepMutex); }
+  m_wakeCondition.notify_one();
+}
+
+void
+JobSystem::wait(JobCounter& counter) {
+  const uint32_t queueIndex = currentQueue();
+  while (!counter.isDone()) {
+    if (!runOne(queueIndex)) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void
+JobSystem::workerLoop(uint32_t queueIndex) {
+  t_jobSystem = this;
+  t_queueIndex = queueIndex;
+  PROFILE_THREAD("Worker " + std::to_string(queueIndex));
+
+  while (m_running.load(std::memory_order_acquire)) {
+    if (runOne(queueIndex)) {
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    m_wakeCondition.wait(lock, [this]() {
+      return !m_running.load(std::memory_order_acquire) ||
+             m_queuedJobs.load(std::memory_order_acquire) > 0;
+    });
+  }
+}
+
+bool
+JobSystem::runOne(uint32_t queueIndex) {
+  Job job;
+
+  // 1) Cola propia, por detras (LIFO: datos aun calientes en cache)
+  {
+    WorkQueue& own = *m_queues[queueIndex];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.jobs.empty()) {
+      job = std::move(own.jobs.back());
+      own.jobs.pop_back();
+    }
+  }
+
+  // 2) Robo desde el frente de las demas colas
+  if (!job) {
+    const uint32_t queueCount = static_cast<uint32_t>(m_queues.size());
+    for (uint32_t offset = 1; offset < queueCount && !job; ++offset) {
+      WorkQueue& victim = *m_queues[(queueIndex + offset) % queueCount];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.jobs.empty()) {
+        job = std::move(victim.jobs.front());
+        victim.jobs.pop_front();
+      }
+    }
+  }
+
+  if (!job) {
+    return false;
+  }
+
+  m_queuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+  PROFILE_ZONE("Job");
+  job();
+  return true;
+}
+
+uint32_t
+JobSystem::currentQueue() const {
+  return t_jobSystem == this ? t_queueIndex : 0;
+}
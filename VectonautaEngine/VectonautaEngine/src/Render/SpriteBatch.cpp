@@ -0,0 +1,103 @@
+#include "Render/SpriteBatch.h"
+#include "Window.h"
+#include "Utilities/Profiler.h"
+#include <algorithm>
+
+/**
+ * @file SpriteBatch.cpp
+ * @brief Implements CPU triangulation of sf::Shape and batched drawing.
+ */
+
+SpriteBatch::SpriteBatch(EngineUtilities::FrameArena& frameArena)
+  : m_vertices(EngineUtilities::TFrameAllocator<sf::Vertex>(frameArena)),
+  m_batches(EngineUtilities::TFrameAllocator<Batch>(frameArena)) {
+}
+
+void
+SpriteBatch::begin() {
+  // Los arreglos del frame anterior se quedan en su bufer de la arena; se piden otros
+  m_vertices = EngineUtilities::TFrameVector<sf::Vertex>(m_vertices.get_allocator());
+  m_batches = EngineUtilities::TFrameVector<Batch>(m_batches.get_allocator());
+  m_vertices.reserve(m_vertexReserve);
+  m_batches.reserve(m_batchReserve);
+  m_drawCalls = 0;
+  m_shapes = 0;
+}
+
+void
+SpriteBatch::add(const sf::Shape& shape, Window& window) {
+  ++m_shapes;
+
+  const size_t pointCount = shape.getPointCount();
+  if (pointCount < 3) {
+    return;
+  }
+
+  // Un contorno no se puede expresar como abanico de relleno: se dibuja aparte
+  if (shape.getOutlineThickness() != 0.f) {
+    flush(window);
+    window.draw(shape);
+    ++m_drawCalls;
+    return;
+  }
+
+  const sf::Texture* texture = shape.getTexture();
+  if (m_batches.empty() || m_batches.back().texture != texture) {
+    m_batches.push_back({ texture, m_vertices.size(), 0 });
+  }
+
+  // Mismo mapeo de UV que sf::Shape: relativo a los limites locales de los puntos
+  sf::Vector2f minPoint = shape.getPoint(0);
+  sf::Vector2f maxPoint = minPoint;
+  for (size_t i = 1; i < pointCount; ++i) {
+    const sf::Vector2f point = shape.getPoint(i);
+    minPoint.x = std::min(minPoint.x, point.x);
+    minPoint.y = std::min(minPoint.y, point.y);
+    maxPoint.x = std::max(maxPoint.x, point.x);
+    maxPoint.y = std::max(maxPoint.y, point.y);
+  }
+  const sf::Vector2f size = maxPoint - minPoint;
+  const sf::IntRect textureRect = shape.getTextureRect();
+  const sf::Transform& transform = shape.getTransform();
+  const sf::Color color = shape.getFillColor();
+
+  auto makeVertex = [&](size_t index) {
+    const sf::Vector2f point = shape.getPoint(index);
+    const float xRatio = size.x > 0.f ? (point.x - minPoint.x) / size.x : 0.f;
+    const float yRatio = size.y > 0.f ? (point.y - minPoint.y) / size.y : 0.f;
+    return sf::Vertex(transform.transformPoint(point),
+                      color,
+                      sf::Vector2f(textureRect.left + textureRect.width * xRatio,
+                                   textureRect.top + textureRect.height * yRatio));
+  };
+
+  // Abanico (0, i, i + 1) -> triangulos sueltos para poder concatenar figuras
+  const sf::Vertex pivot = makeVertex(0);
+  sf::Vertex previous = makeVertex(1);
+  for (size_t i = 2; i < pointCount; ++i) {
+    const sf::Vertex current = makeVertex(i);
+    m_vertices.push_back(pivot);
+    m_vertices.push_back(previous);
+    m_vertices.push_back(current);
+    previous = current;
+  }
+  m_batches.back().count = m_vertices.size() - m_batches.back().first;
+}
+
+void
+SpriteBatch::flush(Window& window) {
+  PROFILE_ZONE("SpriteBatch::flush");
+  for (const Batch& batch : m_batches) {
+    if (batch.count == 0) {
+      continue;
+    }
+    sf::RenderStates states;
+    states.texture = batch.texture;
+    window.draw(&m_vertices[batch.first], batch.count, sf::Triangles, states);
+    ++m_drawCalls;
+  }
+  m_vertexReserve = std::max(m_vertexReserve, m_vertices.size());
+  m_batchReserve = std::max(m_batchReserve, m_batches.size());
+  m_batches.clear();
+  m_vertices.clear();
+}
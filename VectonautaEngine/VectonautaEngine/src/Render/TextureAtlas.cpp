@@ -0,0 +1,174 @@
+#include "Render/TextureAtlas.h"
+#include <algorithm>
+
+/**
+ * @file TextureAtlas.cpp
+ * @brief Implements skyline bottom-left packing of images into atlas pages.
+ */
+
+TextureAtlas::TextureAtlas(uint32_t pageSize, uint32_t padding)
+  : m_pageSize(pageSize),
+  m_padding(padding) {
+}
+
+bool
+TextureAtlas::insert(const sf::Image& image,
+                     EngineUtilities::TSharedPointer<AtlasPage>& outPage,
+                     sf::IntRect& outRect) {
+  return insert(image.getPixelsPtr(), image.getSize().x, image.getSize().y, outPage, outRect);
+}
+
+bool
+TextureAtlas::insert(const uint8_t* pixels,
+                     uint32_t imageWidth,
+                     uint32_t imageHeight,
+                     EngineUtilities::TSharedPointer<AtlasPage>& outPage,
+                     sf::IntRect& outRect) {
+  const sf::Vector2u size(imageWidth, imageHeight);
+  const uint32_t width = size.x + m_padding;
+  const uint32_t height = size.y + m_padding;
+
+  int32_t pageIndex = -1;
+  int32_t nodeIndex = -1;
+  uint32_t x = 0;
+  uint32_t y = 0;
+
+  if (width > m_pageSize || height > m_pageSize) {
+    // Imagen mas grande que una pagina: pagina propia a su medida
+    pageIndex = createPage(size.x, size.y);
+    if (pageIndex < 0) {
+      return false;
+    }
+    nodeIndex = findPosition(m_pages[pageIndex], size.x, size.y, x, y);
+  }
+  else {
+    for (size_t i = 0; i < m_pages.size() && nodeIndex < 0; ++i) {
+      nodeIndex = findPosition(m_pages[i], width, height, x, y);
+      if (nodeIndex >= 0) {
+        pageIndex = static_cast<int32_t>(i);
+      }
+    }
+    if (nodeIndex < 0) {
+      pageIndex = createPage(m_pageSize, m_pageSize);
+      if (pageIndex < 0) {
+        return false;
+      }
+      nodeIndex = findPosition(m_pages[pageIndex], width, height, x, y);
+    }
+  }
+
+  Page& page = m_pages[pageIndex];
+  addSkylineLevel(page, nodeIndex, x, y,
+                  std::min(width, page.width - x),
+                  std::min(height, page.height - y));
+  if (pixels != nullptr) {
+    page.page->texture.update(pixels, size.x, size.y, x, y);
+  }
+
+  outPage = page.page;
+  outRect = sf::IntRect(static_cast<int>(x), static_cast<int>(y),
+                        static_cast<int>(size.x), static_cast<int>(size.y));
+  return true;
+}
+
+int32_t
+TextureAtlas::createPage(uint32_t width, uint32_t height) {
+  Page page;
+  page.page = EngineUtilities::MakeShared<AtlasPage>();
+  if (!page.page->texture.create(width, height)) {
+    std::cerr << "[TextureAtlas] Cannot create page of "
+      << width << "x" << height << "\n";
+    return -1;
+  }
+  page.width = width;
+  page.height = height;
+  page.skyline.push_back({ 0, 0, width });
+  m_pages.push_back(page);
+  return static_cast<int32_t>(m_pages.size() - 1);
+}
+
+int32_t
+TextureAtlas::findPosition(const Page& page,
+                           uint32_t width,
+                           uint32_t height,
+                           uint32_t& outX,
+                           uint32_t& outY) const {
+  int32_t bestIndex = -1;
+  uint32_t bestBottom = UINT32_MAX;
+  uint32_t bestWidth = UINT32_MAX;
+
+  for (size_t i = 0; i < page.skyline.size(); ++i) {
+    const uint32_t x = page.skyline[i].x;
+    if (x + width > page.width) {
+      break;
+    }
+
+    // La altura es la del segmento mas alto que queda debajo del bloque
+    uint32_t y = 0;
+    uint32_t remaining = width;
+    for (size_t j = i; remaining > 0; ++j) {
+      y = std::max(y, page.skyline[j].y);
+      remaining -= std::min(remaining, page.skyline[j].width);
+    }
+    if (y + height > page.height) {
+      continue;
+    }
+
+    const uint32_t bottom = y + height;
+    if (bottom < bestBottom ||
+        (bottom == bestBottom && page.skyline[i].width < bestWidth)) {
+      bestIndex = static_cast<int32_t>(i);
+      bestBottom = bottom;
+      bestWidth = page.skyline[i].width;
+      outX = x;
+      outY = y;
+    }
+  }
+  return bestIndex;
+}
+
+void
+TextureAtlas::addSkylineLevel(Page& page,
+                              int32_t nodeIndex,
+                              uint32_t x,
+                              uint32_t y,
+                              uint32_t width,
+                              uint32_t height) {
+  std::vector<SkylineNode>& skyline = page.skyline;
+  skyline.insert(skyline.begin() + nodeIndex, { x, y + height, width });
+
+  // Recorta los segmentos que quedan bajo el bloque nuevo
+  const uint32_t right = x + width;
+  size_t i = static_cast<size_t>(nodeIndex) + 1;
+  while (i < skyline.size() && skyline[i].x < right) {
+    const uint32_t nodeRight = skyline[i].x + skyline[i].width;
+    if (nodeRight <= right) {
+      skyline.erase(skyline.begin() + i);
+      continue;
+    }
+    skyline[i].width = nodeRight - right;
+    skyline[i].x = right;
+    break;
+  }
+
+  // Une segmentos vecinos a la misma altura
+  for (size_t j = 0; j + 1 < skyline.size();) {
+    if (skyline[j].y == skyline[j + 1].y) {
+      skyline[j].width += skyline[j + 1].width;
+      skyline.erase(skyline.begin() + j + 1);
+    }
+    else {
+      ++j;
+    }
+  }
+}
+
+size_t
+TextureAtlas::releaseUnusedPages() {
+  // Solo el atlas sostiene la pagina: ninguna textura la usa
+  const size_t before = m_pages.size();
+  m_pages.erase(std::remove_if(m_pages.begin(), m_pages.end(),
+                               [](const Page& page) { return page.page.useCount() == 1; }),
+                m_pages.end());
+  return before - m_pages.size();
+}
@@ -1,48 +1,328 @@
 #include "ResourceManager.h"
 #include "Prerequisites.h"  // para ERROR, MESSAGE, etc.
 #include <iostream>         // para std::cerr
+#include <algorithm>
+#include "Utilities/Profiler.h"
 
-bool ResourceManager::loadTexture(const std::string& fileName,
+ResourceManager::~ResourceManager() {
+  // Los jobs escriben en estados que m_pending mantiene vivos
+  if (m_jobSystem != nullptr) {
+    m_jobSystem->wait(m_loadCounter);
+  }
+}
+
+TextureLoadState::Status ResourceManager::loadTexture(const std::string& fileName,
   const std::string& extension)
 {
-  // 1) Si ya est cargada, devolvemos true inmediatamente
+  // 1) Si ya est cargada, es residente
   if (m_textures.find(fileName) != m_textures.end()) {
-    return true;
+    return TextureLoadState::Status::READY;
+  }
+  // 1b) Si ya se est cargando en segundo plano, estar lista tras update()
+  if (m_pending.find(fileName) != m_pending.end()) {
+    return TextureLoadState::Status::LOADING;
   }
 
-  // 2) Creamos y almacenamos la nueva textura
-  auto texture = EngineUtilities::MakeShared<Texture>(fileName, extension);
-  m_textures[fileName] = texture;
-
-  // Podras comprobar aqu si la carga interna de SFML fue exitosa
-  // y devolver false en caso contrario.
+  // 2) La leemos (archivo de assets o disco) y la empaquetamos en el atlas
+  if (loadFromSource(fileName, fileName + "." + extension).isNull()) {
+    std::cerr << "[ResourceManager] Failed to load texture: "
+      << fileName << "." << extension << "\n";
+    return TextureLoadState::Status::FAILED;
+  }
+  return TextureLoadState::Status::READY;
+}
 
+bool
+ResourceManager::mountArchive(const std::string& path)
+{
+  if (!m_archive.open(path)) {
+    return false;
+  }
+  MESSAGE("ResourceManager", "mountArchive",
+    path + " (" + std::to_string(m_archive.getEntryCount()) + " assets)");
   return true;
 }
 
+EngineUtilities::TSharedPointer<Texture>
+ResourceManager::loadFromSource(const std::string& key, const std::string& path)
+{
+  // Del mapeo directo a la GPU, sin copias ni decodificacin
+  AssetArchive::TextureView view;
+  if (m_archive.findTexture(key, view)) {
+    return insertTexture(key, path, view.pixels, view.width, view.height);
+  }
+
+  // Modo desarrollo: archivo suelto
+  sf::Image image;
+  if (!image.loadFromFile(path)) {
+    return EngineUtilities::TSharedPointer<Texture>();
+  }
+  return insertTexture(key, path, image.getPixelsPtr(), image.getSize().x, image.getSize().y);
+}
+
+void
+ResourceManager::setMemoryBudget(size_t bytes)
+{
+  m_memoryBudget = bytes;
+  enforceBudget();
+}
+
+EngineUtilities::TSharedPointer<Texture>
+ResourceManager::insertTexture(const std::string& key,
+  const std::string& path,
+  const uint8_t* pixels,
+  uint32_t width,
+  uint32_t height)
+{
+  // Ya residente: se reutiliza en lugar de ocupar otra zona del atlas
+  auto existing = m_textures.find(key);
+  if (existing != m_textures.end()) {
+    existing->second.lastUse = ++m_useClock;
+    return existing->second.texture;
+  }
+
+  // "Default" queda fijo: en una pgina propia para no retener una pgina del atlas
+  const bool pinned = key == "Default";
+
+  // Esta copia mantiene la textura nueva fuera del alcance de enforceBudget()
+  auto texture = createTexture(pixels, width, height, !pinned);
+
+  TextureEntry& entry = m_textures[key];
+  entry.texture = texture;
+  entry.path = path;
+  entry.lastUse = ++m_useClock;
+  m_evicted.erase(key);
+
+  PageEntry& page = m_pages[texture->getPage().get()];
+  if (page.keys.empty()) {
+    // Pgina nueva: cuenta entera, aunque por ahora solo tenga esta imagen
+    const sf::Vector2u pageSize = texture->getTexture().getSize();
+    page.bytes = size_t(pageSize.x) * pageSize.y * 4;
+    page.pinned = pinned;
+    m_stats.residentBytes += page.bytes;
+    ++m_stats.residentPages;
+  }
+  page.keys.push_back(key);
+
+  enforceBudget();
+  return texture;
+}
+
+void
+ResourceManager::enforceBudget()
+{
+  if (m_memoryBudget == 0) {
+    return;
+  }
+
+  bool evictedAny = false;
+  while (m_stats.residentBytes > m_memoryBudget) {
+    // Pgina expulsable usada hace ms tiempo (su uso es el de su textura ms reciente)
+    const AtlasPage* victim = nullptr;
+    uint64_t victimUse = UINT64_MAX;
+    for (const auto& page : m_pages) {
+      if (page.second.pinned) {
+        continue;
+      }
+      uint64_t lastUse = 0;
+      bool inUse = false;
+      for (const std::string& key : page.second.keys) {
+        const TextureEntry& entry = m_textures.find(key)->second;
+        // Solo si el ResourceManager es el nico dueo de cada textura de la pgina
+        inUse = inUse || entry.texture.useCount() > 1;
+        lastUse = std::max(lastUse, entry.lastUse);
+      }
+      if (!inUse && lastUse < victimUse) {
+        victim = page.first;
+        victimUse = lastUse;
+      }
+    }
+    if (victim == nullptr) {
+      break;
+    }
+    evictPage(victim);
+    evictedAny = true;
+  }
+
+  // Las pginas expulsadas ya no tienen texturas vivas: liberan su memoria de GPU
+  if (evictedAny) {
+    m_atlas.releaseUnusedPages();
+  }
+}
+
+void
+ResourceManager::evictPage(const AtlasPage* page)
+{
+  auto pageIt = m_pages.find(page);
+  for (const std::string& key : pageIt->second.keys) {
+    auto entryIt = m_textures.find(key);
+    m_evicted[key] = entryIt->second.path;
+    m_textures.erase(entryIt);
+    ++m_stats.evictions;
+  }
+  m_stats.residentBytes -= pageIt->second.bytes;
+  --m_stats.residentPages;
+  m_pages.erase(pageIt);
+}
+
+EngineUtilities::TSharedPointer<Texture>
+ResourceManager::createTexture(const uint8_t* pixels,
+  uint32_t width,
+  uint32_t height,
+  bool shared)
+{
+  EngineUtilities::TSharedPointer<AtlasPage> page;
+  sf::IntRect rect;
+  if (shared && m_atlas.insert(pixels, width, height, page, rect)) {
+    return EngineUtilities::MakeShared<Texture>(page, rect);
+  }
+  // Sin pgina disponible (o textura fija): textura propia
+  sf::Image image;
+  image.create(width, height, pixels);
+  return EngineUtilities::MakeShared<Texture>(image);
+}
+
+TextureRequest
+ResourceManager::loadTextureAsync(const std::string& fileName,
+  const std::string& extension)
+{
+  // 1) Ya cargada: el handle nace listo
+  auto loaded = m_textures.find(fileName);
+  if (loaded != m_textures.end()) {
+    loaded->second.lastUse = ++m_useClock;
+    auto state = EngineUtilities::MakeShared<TextureLoadState>();
+    state->key = fileName;
+    state->status = TextureLoadState::Status::READY;
+    state->texture = loaded->second.texture;
+    return TextureRequest(state);
+  }
+
+  // 2) Ya pedida: todas las peticiones de la misma clave comparten el estado
+  auto pending = m_pending.find(fileName);
+  if (pending != m_pending.end()) {
+    return TextureRequest(pending->second);
+  }
+
+  // 2b) En el archivo de assets no hay nada que decodificar: solo la subida
+  AssetArchive::TextureView view;
+  if (m_archive.findTexture(fileName, view)) {
+    auto state = EngineUtilities::MakeShared<TextureLoadState>();
+    state->key = fileName;
+    state->path = fileName + "." + extension;
+    state->texture = insertTexture(fileName, state->path, view.pixels, view.width, view.height);
+    state->status = TextureLoadState::Status::READY;
+    return TextureRequest(state);
+  }
+
+  // 3) Nueva carga con la textura por defecto como placeholder
+  auto state = EngineUtilities::MakeShared<TextureLoadState>();
+  state->key = fileName;
+  state->path = fileName + "." + extension;
+  state->texture = getDefaultTexture();
+  m_pending.emplace(fileName, state);
+
+  // Lectura y decodificacin fuera del hilo dueo; m_pending mantiene vivo el estado
+  TextureLoadState* rawState = state.get();
+  Job decodeJob = [rawState]() {
+    rawState->decodeSucceeded = rawState->image.loadFromFile(rawState->path);
+    rawState->decoded.store(true, std::memory_order_release);
+  };
+  if (m_jobSystem != nullptr) {
+    m_jobSystem->schedule(std::move(decodeJob), &m_loadCounter);
+  }
+  else {
+    decodeJob();
+  }
+
+  return TextureRequest(state);
+}
+
+void
+ResourceManager::update()
+{
+  PROFILE_ZONE("ResourceManager::update");
+  for (auto it = m_pending.begin(); it != m_pending.end();) {
+    TextureLoadState& state = *it->second;
+    if (!state.decoded.load(std::memory_order_acquire)) {
+      ++it;
+      continue;
+    }
+
+    if (state.decodeSucceeded) {
+      // Subida a la GPU en el hilo dueo del contexto
+      state.texture = insertTexture(state.key, state.path, state.image.getPixelsPtr(),
+                                    state.image.getSize().x, state.image.getSize().y);
+      state.status = TextureLoadState::Status::READY;
+    }
+    else {
+      std::cerr << "[ResourceManager] Failed to load texture: "
+        << state.path << ". Keeping default texture.\n";
+      state.status = TextureLoadState::Status::FAILED;
+    }
+
+    // Los pxeles ya estn en la GPU; liberamos la copia en memoria
+    state.image = sf::Image();
+    it = m_pending.erase(it);
+  }
+
+  // Texturas que los actores soltaron desde el frame anterior ya se pueden expulsar
+  enforceBudget();
+}
+
 EngineUtilities::TSharedPointer<Texture>
 ResourceManager::getTexture(const std::string& fileName)
 {
   // 1) Intentamos encontrar la textura solicitada
   auto it = m_textures.find(fileName);
   if (it != m_textures.end()) {
-    return it->second;
+    ++m_stats.hits;
+    it->second.lastUse = ++m_useClock;
+    return it->second.texture;
+  }
+  ++m_stats.misses;
+
+  // 1b) Si est cargando, devolvemos su placeholder sin avisar
+  auto pending = m_pending.find(fileName);
+  if (pending != m_pending.end()) {
+    return pending->second->texture;
+  }
+
+  // 1c) Si se expuls por el presupuesto, se recarga sin que se note
+  auto evicted = m_evicted.find(fileName);
+  if (evicted != m_evicted.end()) {
+    const std::string path = evicted->second;
+    auto texture = loadFromSource(fileName, path);
+    if (!texture.isNull()) {
+      return texture;
+    }
+    std::cerr << "[ResourceManager] Failed to reload texture: " << path << "\n";
+    m_evicted.erase(evicted);
   }
 
   // 2) Si no existe, avisamos y usamos la textura por defecto
   std::cerr << "[ResourceManager] Texture not found: "
     << fileName << ". Using default texture.\n";
 
+  return getDefaultTexture();
+}
+
+EngineUtilities::TSharedPointer<Texture>
+ResourceManager::getDefaultTexture()
+{
   const std::string defaultKey = "Default";
 
   // 2a) Si la textura por defecto ya est cargada, la devolvemos
   auto defaultIt = m_textures.find(defaultKey);
   if (defaultIt != m_textures.end()) {
-    return defaultIt->second;
+    return defaultIt->second.texture;
   }
 
-  // 2b) Si no, la cargamos y la almacenamos
-  auto defaultTexture = EngineUtilities::MakeShared<Texture>(defaultKey, "png");
-  m_textures[defaultKey] = defaultTexture;
+  // 2b) Si no, la cargamos y la almacenamos (blanco si falta el archivo)
+  auto defaultTexture = loadFromSource(defaultKey, defaultKey + ".png");
+  if (defaultTexture.isNull()) {
+    std::cerr << "Error al cargar textura: " << defaultKey << ".png" << std::endl;
+    const uint8_t white[4] = { 255, 255, 255, 255 };
+    defaultTexture = insertTexture(defaultKey, defaultKey + ".png", white, 1, 1);
+  }
   return defaultTexture;
 }
@@ -0,0 +1,488 @@
+#include "Utilities/Benchmarks.h"
+#include "ECS/Actor.h"
+#include "ECS/ArchetypeStorage.h"
+#include "ECS/EntityRegistry.h"
+#include "ECS/SeekTarget.h"
+#include "ECS/Texture.h"
+#include "ECS/Systems/SeekKernel.h"
+#include "ECS/Systems/SeekSystem.h"
+#include "ECS/Transform.h"
+#include "CShape.h"
+#include "Render/SpriteBatch.h"
+#include "Render/TextureAtlas.h"
+#include "Window.h"
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <random>
+
+/**
+ * @file Benchmarks.cpp
+ * @brief Implements the micro-benchmarks selected with --bench.
+ */
+
+namespace {
+  /**
+   * @brief Keeps benchmark results observable so the compiler cannot drop the timed loops.
+   */
+  volatile float g_sink = 0.f;
+
+  /**
+   * @brief Runs func once and returns the elapsed wall-clock time in seconds.
+   */
+  template<typename Func>
+  double
+  timeSeconds(Func&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  /**
+   * @brief Component that only exists in the benchmark, added last so lookups reach the end.
+   */
+  class
+    BenchPayload : public Component {
+  public:
+    explicit BenchPayload(float value) : m_value(value) {}
+
+    void
+      start() override {}
+
+    void
+      update(float) override {}
+
+    void
+      render(const EngineUtilities::TSharedPointer<Window>&) override {}
+
+    void
+      destroy() override {}
+
+    float
+      getValue() const { return m_value; }
+
+  private:
+    float m_value; ///< Value read by the lookups.
+  };
+
+  /**
+   * @brief Actor that can still look components up the way Entity did before the type index.
+   */
+  class
+    LegacyLookupActor : public Actor {
+  public:
+    using Actor::Actor;
+
+    /**
+     * @brief Old lookup: dynamic_pointer_cast on each component until one matches.
+     */
+    template<typename T>
+    EngineUtilities::TSharedPointer<T>
+      findComponent() {
+      for (auto& component : components) {
+        auto typed = component.template dynamic_pointer_cast<T>();
+        if (typed) {
+          return typed;
+        }
+      }
+      return EngineUtilities::TSharedPointer<T>();
+    }
+  };
+
+  /**
+   * @brief Copies every pointer of source into copies and destroys the copies, passes times.
+   * @return Seconds spent.
+   */
+  template<typename Pointer>
+  double
+  copyAndDestroy(const std::vector<Pointer>& source, uint32_t passes) {
+    std::vector<Pointer> copies;
+    copies.reserve(source.size());
+    return timeSeconds([&]() {
+      for (uint32_t pass = 0; pass < passes; ++pass) {
+        copies.assign(source.begin(), source.end());
+        copies.clear();
+      }
+    });
+  }
+}
+
+bool
+Benchmarks::run(const std::string& name, uint32_t size) {
+  if (name == "components") {
+    return components(size > 0 ? size : 10000);
+  }
+  if (name == "refcount") {
+    return refCount(size > 0 ? size : 100000);
+  }
+  if (name == "batch") {
+    return batch(size > 0 ? size : 10000);
+  }
+  if (name == "atlas") {
+    return atlas(size > 0 ? size : 10000);
+  }
+  if (name == "seek") {
+    return seek(size);
+  }
+  std::cerr << "Unknown benchmark: " << name << " (expected one of: " << getNames() << ")\n";
+  return false;
+}
+
+const char*
+Benchmarks::getNames() {
+  return "components refcount batch atlas seek";
+}
+
+bool
+Benchmarks::components(uint32_t actors) {
+  constexpr uint32_t PASSES = 50;
+
+  std::vector<EngineUtilities::TSharedPointer<LegacyLookupActor>> list;
+  list.reserve(actors);
+  for (uint32_t i = 0; i < actors; ++i) {
+    auto actor = EngineUtilities::MakeShared<LegacyLookupActor>("Bench Actor");
+    actor->addComponent(EngineUtilities::MakeShared<BenchPayload>(float(i)));
+    list.push_back(actor);
+  }
+
+  // Cada pasada busca Transform (segundo componente) y BenchPayload (el ultimo)
+  float sum = 0.f;
+  const double scanSeconds = timeSeconds([&]() {
+    for (uint32_t pass = 0; pass < PASSES; ++pass) {
+      for (auto& actor : list) {
+        sum += actor->findComponent<Transform>()->getPosition().x;
+        sum += actor->findComponent<BenchPayload>()->getValue();
+      }
+    }
+  });
+  const double sharedSeconds = timeSeconds([&]() {
+    for (uint32_t pass = 0; pass < PASSES; ++pass) {
+      for (auto& actor : list) {
+        sum += actor->getComponent<Transform>()->getPosition().x;
+        sum += actor->getComponent<BenchPayload>()->getValue();
+      }
+    }
+  });
+  const double rawSeconds = timeSeconds([&]() {
+    for (uint32_t pass = 0; pass < PASSES; ++pass) {
+      for (auto& actor : list) {
+        sum += actor->getComponentPtr<Transform>()->getPosition().x;
+        sum += actor->getComponentPtr<BenchPayload>()->getValue();
+      }
+    }
+  });
+  g_sink = sum;
+
+  const double lookups = 2.0 * PASSES * actors;
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(2)
+     << "Benchmarks::components : [" << actors << " actors, " << PASSES << " passes]\n"
+     << "  dynamic_cast scan  : " << 1e9 * scanSeconds / lookups << " ns/lookup\n"
+     << "  getComponent<T>    : " << 1e9 * sharedSeconds / lookups << " ns/lookup ("
+     << scanSeconds / sharedSeconds << "x)\n"
+     << "  getComponentPtr<T> : " << 1e9 * rawSeconds / lookups << " ns/lookup ("
+     << scanSeconds / rawSeconds << "x)\n";
+  std::cout << os.str();
+  return true;
+}
+
+bool
+Benchmarks::refCount(uint32_t pointers) {
+  constexpr uint32_t PASSES = 50;
+
+  std::vector<EngineUtilities::TSharedPointer<Transform>> plain;
+  std::vector<EngineUtilities::TAtomicSharedPointer<Transform>> atomic;
+  plain.reserve(pointers);
+  atomic.reserve(pointers);
+  for (uint32_t i = 0; i < pointers; ++i) {
+    plain.push_back(EngineUtilities::MakeShared<Transform>());
+    atomic.push_back(EngineUtilities::MakeAtomicShared<Transform>());
+  }
+
+  // Objetos distintos (contadores repartidos por memoria) y un solo objeto (contador en cache)
+  const double plainSeconds = copyAndDestroy(plain, PASSES);
+  const double atomicSeconds = copyAndDestroy(atomic, PASSES);
+  const double plainSameSeconds = copyAndDestroy(
+    std::vector<EngineUtilities::TSharedPointer<Transform>>(pointers, plain.front()), PASSES);
+  const double atomicSameSeconds = copyAndDestroy(
+    std::vector<EngineUtilities::TAtomicSharedPointer<Transform>>(pointers, atomic.front()), PASSES);
+  g_sink = plain.front()->getPosition().x + atomic.front()->getPosition().x;
+
+  const double copies = double(PASSES) * pointers;
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(2)
+     << "Benchmarks::refcount : [" << pointers << " pointers, " << PASSES << " passes]\n"
+     << "  distinct objects : SingleThreadRefCount " << 1e9 * plainSeconds / copies
+     << " ns, AtomicRefCount " << 1e9 * atomicSeconds / copies << " ns per copy+destroy ("
+     << atomicSeconds / plainSeconds << "x)\n"
+     << "  one object       : SingleThreadRefCount " << 1e9 * plainSameSeconds / copies
+     << " ns, AtomicRefCount " << 1e9 * atomicSameSeconds / copies << " ns per copy+destroy ("
+     << atomicSameSeconds / plainSameSeconds << "x)\n";
+  std::cout << os.str();
+  return true;
+}
+
+bool
+Benchmarks::batch(uint32_t shapes) {
+  constexpr uint32_t FRAMES = 60;
+
+  Window window(1920, 1080, "Benchmarks::batch", true);
+  if (!window.isOpen()) {
+    std::cerr << "Benchmarks::batch : cannot create a window\n";
+    return false;
+  }
+
+  // Circulos sin textura repartidos por la ventana, como la multitud
+  std::vector<sf::CircleShape> circles(shapes, sf::CircleShape(8.f));
+  for (uint32_t i = 0; i < shapes; ++i) {
+    circles[i].setPosition(float(i * 37 % 1904), float(i * 91 % 1064));
+    circles[i].setFillColor(sf::Color(255, uint8_t(i * 13), uint8_t(i * 7)));
+  }
+
+  // Antes: un draw por figura
+  uint64_t directCalls = 0;
+  const double directSeconds = timeSeconds([&]() {
+    for (uint32_t frame = 0; frame < FRAMES; ++frame) {
+      window.handleEvents();
+      window.clear();
+      for (const sf::CircleShape& circle : circles) {
+        window.draw(circle);
+        ++directCalls;
+      }
+      window.display();
+    }
+  });
+
+  // Ahora: las figuras seguidas con la misma textura salen en un solo draw
+  EngineUtilities::FrameArena arena;
+  SpriteBatch spriteBatch(arena);
+  uint64_t batchedCalls = 0;
+  const double batchedSeconds = timeSeconds([&]() {
+    for (uint32_t frame = 0; frame < FRAMES; ++frame) {
+      window.handleEvents();
+      window.clear();
+      spriteBatch.begin();
+      for (const sf::CircleShape& circle : circles) {
+        spriteBatch.add(circle, window);
+      }
+      spriteBatch.flush(window);
+      batchedCalls += spriteBatch.getDrawCallCount();
+      window.display();
+      arena.endFrame();
+    }
+  });
+
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(2)
+     << "Benchmarks::batch : [" << shapes << " shapes, " << FRAMES << " frames]\n"
+     << "  one draw per shape : " << double(directCalls) / FRAMES << " draw calls, "
+     << 1000.0 * directSeconds / FRAMES << " ms/frame\n"
+     << "  SpriteBatch        : " << double(batchedCalls) / FRAMES << " draw calls, "
+     << 1000.0 * batchedSeconds / FRAMES << " ms/frame (" << directSeconds / batchedSeconds << "x)\n";
+  std::cout << os.str();
+  return true;
+}
+
+bool
+Benchmarks::atlas(uint32_t shapes) {
+  constexpr uint32_t FRAMES = 60;
+  constexpr uint32_t IMAGES = 16;
+
+  Window window(1920, 1080, "Benchmarks::atlas", true);
+  if (!window.isOpen()) {
+    std::cerr << "Benchmarks::atlas : cannot create a window\n";
+    return false;
+  }
+
+  // Las mismas imagenes, cada una en su textura o empaquetadas en paginas del atlas
+  TextureAtlas textureAtlas;
+  std::vector<EngineUtilities::TSharedPointer<Texture>> separate;
+  std::vector<EngineUtilities::TSharedPointer<Texture>> packed;
+  for (uint32_t i = 0; i < IMAGES; ++i) {
+    sf::Image image;
+    image.create(32, 32, sf::Color(uint8_t(i * 16), uint8_t(255 - i * 16), 128));
+    separate.push_back(EngineUtilities::MakeShared<Texture>(image));
+    EngineUtilities::TSharedPointer<AtlasPage> page;
+    sf::IntRect rect;
+    if (!textureAtlas.insert(image, page, rect)) {
+      std::cerr << "Benchmarks::atlas : cannot pack image " << i << "\n";
+      return false;
+    }
+    packed.push_back(EngineUtilities::MakeShared<Texture>(page, rect));
+  }
+
+  // Figuras que alternan imagen, como actores con sprites distintos
+  auto makeShapes = [shapes](std::vector<EngineUtilities::TSharedPointer<Texture>>& textures) {
+    std::vector<sf::RectangleShape> rectangles(shapes, sf::RectangleShape(sf::Vector2f(16.f, 16.f)));
+    for (uint32_t i = 0; i < shapes; ++i) {
+      Texture& texture = *textures[i % IMAGES];
+      rectangles[i].setPosition(float(i * 37 % 1904), float(i * 91 % 1064));
+      rectangles[i].setTexture(&texture.getTexture());
+      rectangles[i].setTextureRect(texture.getTextureRect());
+    }
+    return rectangles;
+  };
+
+  EngineUtilities::FrameArena arena;
+  SpriteBatch spriteBatch(arena);
+  auto drawFrames = [&](const std::vector<sf::RectangleShape>& rectangles,
+                        uint64_t& binds,
+                        uint64_t& drawCalls) {
+    binds = 0;
+    drawCalls = 0;
+    return timeSeconds([&]() {
+      for (uint32_t frame = 0; frame < FRAMES; ++frame) {
+        window.handleEvents();
+        window.clear();
+        spriteBatch.begin();
+        const sf::Texture* bound = nullptr;
+        for (const sf::RectangleShape& rectangle : rectangles) {
+          // Cada cambio de textura entre figuras seguidas es un bind en la GPU
+          if (rectangle.getTexture() != bound) {
+            bound = rectangle.getTexture();
+            ++binds;
+          }
+          spriteBatch.add(rectangle, window);
+        }
+        spriteBatch.flush(window);
+        drawCalls += spriteBatch.getDrawCallCount();
+        window.display();
+        arena.endFrame();
+      }
+    });
+  };
+
+  uint64_t separateBinds = 0;
+  uint64_t separateCalls = 0;
+  uint64_t packedBinds = 0;
+  uint64_t packedCalls = 0;
+  const double separateSeconds = drawFrames(makeShapes(separate), separateBinds, separateCalls);
+  const double packedSeconds = drawFrames(makeShapes(packed), packedBinds, packedCalls);
+
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(2)
+     << "Benchmarks::atlas : [" << shapes << " shapes, " << IMAGES << " images, "
+     << FRAMES << " frames]\n"
+     << "  one texture per image : " << double(separateBinds) / FRAMES << " binds, "
+     << double(separateCalls) / FRAMES << " draw calls, "
+     << 1000.0 * separateSeconds / FRAMES << " ms/frame\n"
+     << "  atlas pages           : " << double(packedBinds) / FRAMES << " binds, "
+     << double(packedCalls) / FRAMES << " draw calls, "
+     << 1000.0 * packedSeconds / FRAMES << " ms/frame (" << separateSeconds / packedSeconds << "x)\n";
+  std::cout << os.str();
+  return true;
+}
+
+bool
+Benchmarks::seek(uint32_t agents) {
+  if (agents > 0) {
+    return seekAgents(agents);
+  }
+  bool identical = true;
+  for (uint32_t count : { 1000u, 10000u, 100000u, 1000000u }) {
+    identical = seekAgents(count) && identical;
+  }
+  return identical;
+}
+
+bool
+Benchmarks::seekAgents(uint32_t agents) {
+  constexpr float DELTA_TIME = 1.f / 60.f;
+  // Unos 20 millones de pasos por camino, con al menos 4 ticks
+  const uint32_t ticks = std::max(4u, 20000000u / agents);
+
+  EntityRegistry registry;
+  ArchetypeStorage storage;
+  registry.reserve(agents);
+  std::mt19937 random(1);
+  std::uniform_real_distribution<float> coordinate(0.f, 1920.f);
+  std::uniform_real_distribution<float> speed(50.f, 200.f);
+  std::uniform_real_distribution<float> range(0.f, 4.f);
+  for (uint32_t i = 0; i < agents; ++i) {
+    EntityHandle handle = registry.spawn<Actor>("Seek Agent");
+    Actor* actor = registry.get<Actor>(handle);
+    const sf::Vector2f position(coordinate(random), coordinate(random));
+    // Uno de cada 16 ya esta en su objetivo, para cubrir tambien la rama de llegada
+    const sf::Vector2f target = (i % 16 == 0) ? position : sf::Vector2f(coordinate(random), coordinate(random));
+    actor->getComponentPtr<Transform>()->setPosition(position);
+    actor->addComponent(EngineUtilities::MakePooledShared<SeekTarget>(target, speed(random), range(random)));
+    actor->setStorage(&storage);
+  }
+
+  // Los kernels leen los mismos arreglos que junta SeekSystem, en el orden de las filas
+  std::vector<sf::Vector2f> start;
+  std::vector<sf::Vector2f> targets;
+  std::vector<float> speeds;
+  std::vector<float> ranges;
+  storage.forEach(makeSignature<Transform, SeekTarget>(), [&](Archetype& archetype) {
+    const std::vector<sf::Vector2f>& positions = archetype.getTransforms().positions;
+    for (uint32_t row = 0; row < archetype.size(); ++row) {
+      const SeekTarget* seek = archetype.getComponent<SeekTarget>(row);
+      start.push_back(positions[row]);
+      targets.push_back(seek->getTarget());
+      speeds.push_back(seek->getSpeed());
+      ranges.push_back(seek->getRange());
+    }
+  });
+
+  auto runKernel = [&](SeekKernel::Function kernel, std::vector<sf::Vector2f>& positions) {
+    positions = start;
+    return timeSeconds([&]() {
+      for (uint32_t tick = 0; tick < ticks; ++tick) {
+        kernel(positions.data(), targets.data(), speeds.data(), ranges.data(), agents, DELTA_TIME);
+      }
+    });
+  };
+  auto sameBits = [](const std::vector<sf::Vector2f>& lhs, const std::vector<sf::Vector2f>& rhs) {
+    return lhs.size() == rhs.size() &&
+           std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(sf::Vector2f)) == 0;
+  };
+
+  std::vector<sf::Vector2f> reference;
+  const double scalarSeconds = runKernel(&SeekKernel::seekScalar, reference);
+  const double steps = double(ticks) * agents;
+
+  bool identical = true;
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(2)
+     << "Benchmarks::seek : [" << agents << " agents, " << ticks << " ticks]\n"
+     << "  " << std::left << std::setw(10) << SeekKernel::getName(SeekKernel::Path::SCALAR)
+     << ": " << 1e9 * scalarSeconds / steps << " ns/agent\n";
+  const SeekKernel::Path widest = SeekKernel::detect();
+  for (SeekKernel::Path path : { SeekKernel::Path::SSE, SeekKernel::Path::AVX }) {
+    if (path > widest) {
+      os << "  " << std::setw(10) << SeekKernel::getName(path) << ": not supported by this CPU\n";
+      continue;
+    }
+    std::vector<sf::Vector2f> positions;
+    const double seconds = runKernel(SeekKernel::get(path), positions);
+    const bool same = sameBits(positions, reference);
+    identical = identical && same;
+    os << "  " << std::setw(10) << SeekKernel::getName(path) << ": " << 1e9 * seconds / steps
+       << " ns/agent (" << scalarSeconds / seconds << "x), "
+       << (same ? "bit-identical" : "MISMATCH") << "\n";
+  }
+
+  // El sistema completo (juntar + kernel elegido) sobre las filas de verdad, en un hilo
+  SeekSystem system;
+  const double systemSeconds = timeSeconds([&]() {
+    for (uint32_t tick = 0; tick < ticks; ++tick) {
+      system.run(storage, DELTA_TIME);
+    }
+  });
+  std::vector<sf::Vector2f> systemPositions;
+  storage.forEach(makeSignature<Transform, SeekTarget>(), [&](Archetype& archetype) {
+    const std::vector<sf::Vector2f>& positions = archetype.getTransforms().positions;
+    systemPositions.insert(systemPositions.end(), positions.begin(), positions.begin() + archetype.size());
+  });
+  const bool systemSame = sameBits(systemPositions, reference);
+  identical = identical && systemSame;
+  os << "  " << std::setw(10) << "SeekSystem" << ": " << 1e9 * systemSeconds / steps
+     << " ns/agent with gather, " << SeekKernel::getName(SeekKernel::choose()) << " kernel, "
+     << (systemSame ? "bit-identical" : "MISMATCH") << "\n" << std::right;
+  std::cout << os.str();
+  if (!identical) {
+    std::cerr << "Benchmarks::seek : a kernel path diverged from the scalar reference\n";
+  }
+  return identical;
+}
@@ -0,0 +1,89 @@
+#include "Utilities/ErrorReport.h"
+#include "Utilities/Logger.h"
+#include <array>
+#include <atomic>
+#include <cstdlib>
+
+/**
+ * @file ErrorReport.cpp
+ * @brief Implements error counting and the error policy.
+ */
+
+namespace {
+#if defined(NDEBUG)
+  std::atomic<ErrorPolicy> g_policy{ ErrorPolicy::LOG_AND_CONTINUE };
+#else
+  std::atomic<ErrorPolicy> g_policy{ ErrorPolicy::ABORT };
+#endif
+
+  std::array<std::atomic<uint64_t>, static_cast<size_t>(ErrorCode::COUNT)> g_counts{};
+}
+
+ErrorCode
+ErrorReport::report(ErrorCode code, const char* classObj, const char* method, const std::string& message) {
+  return report(code, classObj, method, message.c_str());
+}
+
+ErrorCode
+ErrorReport::report(ErrorCode code, const char* classObj, const char* method, const char* message) {
+  g_counts[static_cast<size_t>(code)].fetch_add(1, std::memory_order_relaxed);
+
+  const ErrorPolicy policy = g_policy.load(std::memory_order_relaxed);
+  if (policy == ErrorPolicy::COUNT_ONLY) {
+    return code;
+  }
+
+  std::string text = getName(code);
+  text += ": ";
+  text += message;
+  if (policy == ErrorPolicy::LOG_AND_CONTINUE) {
+    Logger::log(LogLevel::FAILURE, classObj, method, text);
+    return code;
+  }
+
+  Logger::log(LogLevel::FATAL, classObj, method, text);
+  Logger::flush();
+  std::exit(1);
+}
+
+void
+ErrorReport::setPolicy(ErrorPolicy policy) {
+  g_policy.store(policy, std::memory_order_relaxed);
+}
+
+ErrorPolicy
+ErrorReport::getPolicy() {
+  return g_policy.load(std::memory_order_relaxed);
+}
+
+uint64_t
+ErrorReport::getCount() {
+  uint64_t total = 0;
+  for (const auto& count : g_counts) {
+    total += count.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+uint64_t
+ErrorReport::getCount(ErrorCode code) {
+  return g_counts[static_cast<size_t>(code)].load(std::memory_order_relaxed);
+}
+
+void
+ErrorReport::resetCounts() {
+  for (auto& count : g_counts) {
+    count.store(0, std::memory_order_relaxed);
+  }
+}
+
+const char*
+ErrorReport::getName(ErrorCode code) {
+  switch (code) {
+  case ErrorCode::OK: return "OK";
+  case ErrorCode::NOT_INITIALIZED: return "NOT_INITIALIZED";
+  case ErrorCode::INVALID_ARGUMENT: return "INVALID_ARGUMENT";
+  case ErrorCode::RESOURCE_FAILURE: return "RESOURCE_FAILURE";
+  default: return "FAILURE";
+  }
+}
@@ -0,0 +1,234 @@
+#include "Utilities/Logger.h"
+#include "Utilities/Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <iostream>
+#include <mutex>
+
+/**
+ * @file Logger.cpp
+ * @brief Implements per-thread log rings and the background flush thread.
+ */
+
+namespace {
+  /**
+   * @brief Records per thread ring (power of two).
+   */
+  constexpr uint32_t RING_SIZE = 1024;
+
+  /**
+   * @brief Time the flush thread sleeps between drains when nobody asks for a flush.
+   */
+  constexpr std::chrono::milliseconds FLUSH_PERIOD(5);
+
+  /**
+   * @struct LogRecord
+   * @brief One unformatted record.
+   */
+  struct
+    LogRecord {
+    uint64_t timestampNs;                  ///< Profiler::now() at the call.
+    const char* classObj;                  ///< Literal.
+    const char* method;                    ///< Literal.
+    const char* literal;                   ///< Literal state, or nullptr.
+    uint32_t threadId;                     ///< Ring index of the calling thread.
+    uint8_t length;                        ///< Characters used in text.
+    LogLevel level;                        ///< Severity.
+    char text[Logger::STATE_CHARS];        ///< Copied state when literal is nullptr.
+  };
+
+  /**
+   * @struct LogRing
+   * @brief Single-producer single-consumer ring owned by one thread.
+   */
+  struct
+    LogRing {
+    LogRecord records[RING_SIZE];
+    std::atomic<uint32_t> head{ 0 }; ///< Next slot the owner writes.
+    std::atomic<uint32_t> tail{ 0 }; ///< Next slot the flush thread reads.
+    uint32_t threadId = 0;           ///< Printed with each record.
+  };
+
+  const char*
+  levelName(LogLevel level) {
+    switch (level) {
+    case LogLevel::TRACE: return "TRACE";
+    case LogLevel::INFO: return "INFO";
+    case LogLevel::WARNING: return "WARNING";
+    case LogLevel::FAILURE: return "ERROR";
+    default: return "FATAL";
+    }
+  }
+
+  /**
+   * @class LogBackend
+   * @brief Owns the rings and the flush thread. Created on first use, joined at exit.
+   */
+  class
+    LogBackend {
+  public:
+    LogBackend() : m_thread(&LogBackend::flushLoop, this) {}
+
+    ~LogBackend() {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+      }
+      m_wake.notify_all();
+      m_thread.join();
+      drain();
+    }
+
+    LogRing&
+    ring() {
+      thread_local LogRing* t_ring = nullptr;
+      if (t_ring == nullptr) {
+        std::lock_guard<std::mutex> lock(m_ringsMutex);
+        m_rings.push_back(std::make_unique<LogRing>());
+        t_ring = m_rings.back().get();
+        t_ring->threadId = static_cast<uint32_t>(m_rings.size());
+      }
+      return *t_ring;
+    }
+
+    /**
+     * @brief Wakes the flush thread and waits until it has drained everything pushed so far.
+     */
+    void
+    flush() {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      const uint64_t target = ++m_flushRequests;
+      m_wake.notify_all();
+      m_flushed.wait(lock, [this, target]() { return m_flushesDone >= target || !m_running; });
+    }
+
+    std::atomic<uint64_t> dropped{ 0 }; ///< Records lost to full rings.
+
+  private:
+    void
+    flushLoop() {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      while (m_running) {
+        m_wake.wait_for(lock, FLUSH_PERIOD);
+        const uint64_t requests = m_flushRequests;
+        lock.unlock();
+        drain();
+        lock.lock();
+        m_flushesDone = requests;
+        m_flushed.notify_all();
+      }
+    }
+
+    /**
+     * @brief Formats every pending record, oldest first, and writes them at once.
+     */
+    void
+    drain() {
+      m_batch.clear();
+      {
+        std::lock_guard<std::mutex> lock(m_ringsMutex);
+        for (auto& ring : m_rings) {
+          const uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+          const uint32_t head = ring->head.load(std::memory_order_acquire);
+          for (uint32_t i = tail; i != head; ++i) {
+            m_batch.push_back(ring->records[i & (RING_SIZE - 1)]);
+          }
+          ring->tail.store(head, std::memory_order_release);
+        }
+      }
+      if (m_batch.empty()) {
+        return;
+      }
+      std::stable_sort(m_batch.begin(), m_batch.end(), [](const LogRecord& a, const LogRecord& b) {
+        return a.timestampNs < b.timestampNs;
+      });
+
+      m_text.clear();
+      char prefix[64];
+      for (const LogRecord& record : m_batch) {
+        std::snprintf(prefix, sizeof(prefix), "[%10.6f] [T%u] %-7s ",
+                      double(record.timestampNs) * 1e-9, record.threadId, levelName(record.level));
+        m_text += prefix;
+        m_text += record.classObj;
+        m_text += "::";
+        m_text += record.method;
+        m_text += " : [";
+        if (record.literal != nullptr) {
+          m_text += record.literal;
+        }
+        else {
+          m_text.append(record.text, record.length);
+        }
+        m_text += "]\n";
+      }
+      std::cerr.write(m_text.data(), static_cast<std::streamsize>(m_text.size()));
+      std::cerr.flush();
+    }
+
+    std::mutex m_ringsMutex;                      ///< Guards m_rings (registration and drain).
+    std::vector<std::unique_ptr<LogRing>> m_rings; ///< One ring per thread that logged.
+    std::vector<LogRecord> m_batch;               ///< Scratch: records of one drain.
+    std::string m_text;                           ///< Scratch: formatted output of one drain.
+    std::mutex m_mutex;                           ///< Guards the fields below.
+    std::condition_variable m_wake;               ///< Wakes the flush thread early.
+    std::condition_variable m_flushed;            ///< Signals a finished drain.
+    uint64_t m_flushRequests = 0;                 ///< flush() calls so far.
+    uint64_t m_flushesDone = 0;                   ///< Requests covered by finished drains.
+    bool m_running = true;                        ///< Cleared on shutdown.
+    std::thread m_thread;                         ///< Flush thread; declared last so it starts last.
+  };
+
+  LogBackend&
+  backend() {
+    static LogBackend instance;
+    return instance;
+  }
+}
+
+void
+Logger::push(LogLevel level,
+             const char* classObj,
+             const char* method,
+             const char* literal,
+             const char* text,
+             size_t length) {
+  LogBackend& logBackend = backend();
+  LogRing& ring = logBackend.ring();
+  const uint32_t head = ring.head.load(std::memory_order_relaxed);
+  if (head - ring.tail.load(std::memory_order_acquire) >= RING_SIZE) {
+    if (level != LogLevel::FATAL) {
+      logBackend.dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    // Un error fatal nunca se pierde: se espera a que el hilo de volcado vacie el anillo
+    logBackend.flush();
+  }
+
+  LogRecord& record = ring.records[head & (RING_SIZE - 1)];
+  record.timestampNs = Profiler::now();
+  record.classObj = classObj;
+  record.method = method;
+  record.literal = literal;
+  record.threadId = ring.threadId;
+  record.level = level;
+  record.length = 0;
+  if (literal == nullptr) {
+    record.length = static_cast<uint8_t>(std::min(length, STATE_CHARS));
+    std::memcpy(record.text, text, record.length);
+  }
+  ring.head.store(head + 1, std::memory_order_release);
+}
+
+void
+Logger::flush() {
+  backend().flush();
+}
+
+uint64_t
+Logger::getDroppedCount() {
+  return backend().dropped.load(std::memory_order_relaxed);
+}
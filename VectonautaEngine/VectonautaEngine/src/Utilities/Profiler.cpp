@@ -0,0 +1,167 @@
+#include "Utilities/Profiler.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+
+/**
+ * @file Profiler.cpp
+ * @brief Implements per-thread event buffers and Chrome trace export.
+ */
+
+namespace {
+  /**
+   * @brief Events each thread can hold per capture.
+   */
+  constexpr uint32_t EVENTS_PER_THREAD = 1u << 16;
+
+  /**
+   * @struct ThreadBuffer
+   * @brief Events of one thread. Only the owning thread writes; readers stop at count.
+   */
+  struct
+    ThreadBuffer {
+    std::unique_ptr<ProfileEvent[]> events{ new ProfileEvent[EVENTS_PER_THREAD] };
+    std::atomic<uint32_t> count{ 0 };   ///< Published events.
+    std::atomic<uint32_t> capture{ 0 }; ///< Capture the events belong to.
+    uint32_t threadId = 0;              ///< Index used as tid in traces.
+    std::string name;                   ///< Thread name, set by setThreadName.
+  };
+
+  std::atomic<bool> g_recording{ false };
+  std::atomic<uint32_t> g_capture{ 0 };
+  std::atomic<uint64_t> g_dropped{ 0 };
+  std::mutex g_buffersMutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> g_buffers;
+  thread_local ThreadBuffer* t_buffer = nullptr;
+
+  /**
+   * @brief Returns the calling thread's buffer, registering it on first use.
+   */
+  ThreadBuffer&
+  threadBuffer() {
+    if (t_buffer == nullptr) {
+      std::lock_guard<std::mutex> lock(g_buffersMutex);
+      g_buffers.push_back(std::make_unique<ThreadBuffer>());
+      t_buffer = g_buffers.back().get();
+      t_buffer->threadId = static_cast<uint32_t>(g_buffers.size());
+    }
+    return *t_buffer;
+  }
+
+  /**
+   * @brief Writes a string as a JSON literal.
+   */
+  void
+  writeJsonString(std::ostream& out, const char* text) {
+    out << '"';
+    for (const char* c = text; *c != '\0'; ++c) {
+      if (*c == '"' || *c == '\\') {
+        out << '\\' << *c;
+      }
+      else if (static_cast<unsigned char>(*c) >= 0x20) {
+        out << *c;
+      }
+    }
+    out << '"';
+  }
+}
+
+uint64_t
+Profiler::now() {
+  static const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - origin).count());
+}
+
+void
+Profiler::start() {
+  now();
+  g_dropped.store(0, std::memory_order_relaxed);
+  g_capture.fetch_add(1, std::memory_order_acq_rel);
+  g_recording.store(true, std::memory_order_release);
+}
+
+void
+Profiler::stop() {
+  g_recording.store(false, std::memory_order_release);
+}
+
+bool
+Profiler::isRecording() {
+  return g_recording.load(std::memory_order_relaxed);
+}
+
+void
+Profiler::record(const char* name, uint64_t startNs, uint64_t endNs) {
+  if (!isRecording()) {
+    return;
+  }
+  ThreadBuffer& buffer = threadBuffer();
+
+  // Primer evento de una captura nueva: el propio hilo vacia su buffer
+  const uint32_t capture = g_capture.load(std::memory_order_acquire);
+  if (buffer.capture.load(std::memory_order_relaxed) != capture) {
+    buffer.count.store(0, std::memory_order_relaxed);
+    buffer.capture.store(capture, std::memory_order_release);
+  }
+
+  const uint32_t index = buffer.count.load(std::memory_order_relaxed);
+  if (index >= EVENTS_PER_THREAD) {
+    g_dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  buffer.events[index] = ProfileEvent{ name, startNs, endNs - startNs };
+  buffer.count.store(index + 1, std::memory_order_release);
+}
+
+void
+Profiler::setThreadName(const std::string& name) {
+  ThreadBuffer& buffer = threadBuffer();
+  std::lock_guard<std::mutex> lock(g_buffersMutex);
+  buffer.name = name;
+}
+
+bool
+Profiler::writeChromeTrace(const std::string& path) {
+  std::ofstream out(path, std::ios::binary);
+  if (!out) {
+    return false;
+  }
+
+  const uint32_t capture = g_capture.load(std::memory_order_acquire);
+  std::lock_guard<std::mutex> lock(g_buffersMutex);
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool first = true;
+  char timing[96];
+  for (const auto& buffer : g_buffers) {
+    if (!buffer->name.empty()) {
+      out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+          << buffer->threadId << ",\"args\":{\"name\":";
+      writeJsonString(out, buffer->name.c_str());
+      out << "}}";
+      first = false;
+    }
+    if (buffer->capture.load(std::memory_order_acquire) != capture) {
+      continue;
+    }
+    const uint32_t count = buffer->count.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < count; ++i) {
+      const ProfileEvent& event = buffer->events[i];
+      // trace_event usa microsegundos; tres decimales conservan los nanosegundos
+      std::snprintf(timing, sizeof(timing), ",\"ts\":%.3f,\"dur\":%.3f",
+                    double(event.startNs) / 1000.0, double(event.durationNs) / 1000.0);
+      out << (first ? "" : ",") << "\n{\"name\":";
+      writeJsonString(out, event.name);
+      out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId << timing << "}";
+      first = false;
+    }
+  }
+  out << "\n]}\n";
+  return static_cast<bool>(out);
+}
+
+uint64_t
+Profiler::getDroppedCount() {
+  return g_dropped.load(std::memory_order_relaxed);
+}
@@ -18,16 +18,49 @@
   * @param height Height of the window in pixels.
   * @param title Title of the window.
   */
-Window::Window(int width, int height, const std::string& title) {
+Window::Window(int width, int height, const std::string& title)
+  : Window(width, height, title, false) {
+}
+
+/**
+ * @brief Constructs a new Window object, on-screen or headless.
+ *
+ * On-screen windows get a 60 FPS limit. Headless windows render into an sf::RenderTexture
+ * without any limit; when the texture cannot be created (no GL context) the window stays
+ * usable but draw calls are dropped.
+ *
+ * @param width Width of the render target in pixels.
+ * @param height Height of the render target in pixels.
+ * @param title Title of the window.
+ * @param headless true to render off-screen.
+ */
+Window::Window(int width, int height, const std::string& title, bool headless)
+  : m_headless(headless) {
+  if (m_headless) {
+    m_headlessOpen = true;
+    m_texturePtr = EngineUtilities::MakeUnique<sf::RenderTexture>();
+    if (m_texturePtr->create(width, height)) {
+      m_target = m_texturePtr.get();
+      MESSAGE("Window", "Window", "Headless render target created successfully");
+    }
+    else {
+      // Sin contexto GL: solo se ejecuta la parte de CPU del render
+      m_texturePtr.reset();
+      MESSAGE("Window", "Window", "Headless without GL context, draws are skipped");
+    }
+    return;
+  }
+
   m_windowPtr = EngineUtilities::MakeUnique<sf::RenderWindow>(
     sf::VideoMode(width, height), title);
 
   if (!m_windowPtr.isNull()) {
     m_windowPtr->setFramerateLimit(60);
+    m_target = m_windowPtr.get();
     MESSAGE("Window", "Window", "Window created successfully");
   }
   else {
-    ERROR("Window", "Window", "Failed to create window");
+    REPORT_ERROR(ErrorCode::RESOURCE_FAILURE, "Window", "Window", "Failed to create window");
   }
 }
 
@@ -35,6 +68,8 @@ Window::Window(int width, int height, const std::string& title) {
  * @brief Destroys the Window object and safely releases its resources.
  */
 Window::~Window() {
+  m_target = nullptr;
+  m_texturePtr.reset();
   m_windowPtr.release();
 }
 
@@ -44,6 +79,9 @@ Window::~Window() {
  * Processes the event queue to detect and handle user actions like closing the window.
  */
 void Window::handleEvents() {
+  if (m_headless) {
+    return;
+  }
   sf::Event event;
   while (m_windowPtr->pollEvent(event)) {
     if (event.type == sf::Event::Closed) {
@@ -52,17 +90,32 @@ void Window::handleEvents() {
   }
 }
 
+/**
+ * @brief Closes the window; a headless window simply reports itself as closed.
+ */
+void Window::close() {
+  if (m_headless) {
+    m_headlessOpen = false;
+  }
+  else if (!m_windowPtr.isNull()) {
+    m_windowPtr->close();
+  }
+}
+
 /**
  * @brief Checks if the window is currently open.
  *
  * @return true if the window is open, false otherwise.
  */
 bool Window::isOpen() const {
+  if (m_headless) {
+    return m_headlessOpen;
+  }
   if (!m_windowPtr.isNull()) {
     return m_windowPtr->isOpen();
   }
   else {
-    ERROR("Window", "isOpen", "Window is null");
+    REPORT_ERROR(ErrorCode::NOT_INITIALIZED, "Window", "isOpen", "Window is null");
     return false;
   }
 }
@@ -73,11 +126,11 @@ bool Window::isOpen() const {
  * @param color The color to use when clearing the window.
  */
 void Window::clear(const sf::Color& color) {
-  if (!m_windowPtr.isNull()) {
-    m_windowPtr->clear(color);
+  if (VECTONAUTA_LIKELY(m_target)) {
+    m_target->clear(color);
   }
-  else {
-    ERROR("Window", "clear", "Window is null");
+  else if (!m_headless) {
+    REPORT_ERROR(ErrorCode::NOT_INITIALIZED, "Window", "clear", "Window is null");
   }
 }
 
@@ -88,11 +141,31 @@ void Window::clear(const sf::Color& color) {
  * @param states Optional render states to apply to the drawable.
  */
 void Window::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
-  if (!m_windowPtr.isNull()) {
-    m_windowPtr->draw(drawable, states);
+  if (VECTONAUTA_LIKELY(m_target)) {
+    m_target->draw(drawable, states);
   }
-  else {
-    ERROR("Window", "draw", "Window is null");
+  else if (!m_headless) {
+    REPORT_ERROR(ErrorCode::NOT_INITIALIZED, "Window", "draw", "Window is null");
+  }
+}
+
+/**
+ * @brief Draws a vertex range using specified render states.
+ *
+ * @param vertices Pointer to the first vertex.
+ * @param vertexCount Number of vertices.
+ * @param type Primitive type formed by the vertices.
+ * @param states Render states to apply.
+ */
+void Window::draw(const sf::Vertex* vertices,
+                  size_t vertexCount,
+                  sf::PrimitiveType type,
+                  const sf::RenderStates& states) {
+  if (VECTONAUTA_LIKELY(m_target)) {
+    m_target->draw(vertices, vertexCount, type, states);
+  }
+  else if (!m_headless) {
+    REPORT_ERROR(ErrorCode::NOT_INITIALIZED, "Window", "draw", "Window is null");
   }
 }
 
@@ -103,8 +176,11 @@ void Window::display() {
   if (!m_windowPtr.isNull()) {
     m_windowPtr->display();
   }
-  else {
-    ERROR("Window", "display", "Window is null");
+  else if (!m_texturePtr.isNull()) {
+    m_texturePtr->display();
+  }
+  else if (!m_headless) {
+    REPORT_ERROR(ErrorCode::NOT_INITIALIZED, "Window", "display", "Window is null");
   }
 }
 
@@ -118,5 +194,7 @@ Window::update() {
  * @brief Destroys the window and releases its resources safely.
  */
 void Window::destroy() {
+  m_target = nullptr;
+  m_texturePtr.reset();
   m_windowPtr.release();
 }
\ No newline at end of file
@@ -1,4 +1,9 @@
 #include "BaseApp.h"
+#include "Assets/AssetArchive.h"
+#include "Utilities/Benchmarks.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 
 
 /**
@@ -10,11 +15,99 @@
   * @brief Main function that initializes and runs the application.
   *
   * Creates an instance of the BaseApp class and calls its run method to start the application loop.
+  * Optional arguments turn the run into a benchmark:
+  *   --headless        render off-screen without a frame limit. There is no window to close,
+  *                     so it runs AppConfig::DEFAULT_HEADLESS_FRAMES frames unless --frames
+  *                     is given.
+  *   --frames N        stop after N frames and print frame statistics.
+  *   --timestep S      advance the simulation by S seconds per frame.
+  *   --tickrate HZ     simulation ticks per second (default 60).
+  *   --crowd N         add N actors that follow the track path (at most
+  *                     EntityRegistry::CAPACITY, minus the track and Mario).
+  *   --churn K         despawn and respawn K crowd actors every frame.
+  *   --no-pool         allocate actors and components with MakeShared instead of the pools.
+  *   --archive PATH    packed assets to mount (default Assets.vpk).
+  *   --profile PATH    write a Chrome trace of the run (needs VECTONAUTA_PROFILE).
+  *   --on-error MODE   abort, log or count recoverable errors (see ErrorPolicy).
+  * Packing tool mode:
+  *   --pack OUT ROOT FILES  decode the image FILES into the archive OUT and exit. Keys are
+  *                     the paths relative to ROOT, the directory the game runs from.
+  * Micro-benchmark mode:
+  *   --bench NAME [N]  run the benchmark NAME with problem size N and exit
+  *                     (see Benchmarks::getNames()).
   *
   * @return int Exit status of the application. Returns 0 on successful execution.
   */
 int
-main() {
-  BaseApp app;
+main(int argc, char* argv[]) {
+  if (argc >= 4 && std::strcmp(argv[1], "--pack") == 0) {
+    std::vector<std::string> files(argv + 4, argv + argc);
+    return AssetArchive::pack(files, argv[3], argv[2]) ? 0 : 1;
+  }
+  if (argc >= 3 && std::strcmp(argv[1], "--bench") == 0) {
+    const uint32_t size = argc >= 4 ? static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 0;
+    return Benchmarks::run(argv[2], size) ? 0 : 1;
+  }
+
+  AppConfig config;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--headless") == 0) {
+      config.headless = true;
+    }
+    else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      config.frameCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    }
+    else if (std::strcmp(argv[i], "--timestep") == 0 && i + 1 < argc) {
+      config.fixedTimestep = std::strtof(argv[++i], nullptr);
+    }
+    else if (std::strcmp(argv[i], "--tickrate") == 0 && i + 1 < argc) {
+      config.tickRate = std::strtof(argv[++i], nullptr);
+    }
+    else if (std::strcmp(argv[i], "--crowd") == 0 && i + 1 < argc) {
+      const unsigned long crowd = std::strtoul(argv[++i], nullptr, 10);
+      if (crowd > EntityRegistry::CAPACITY) {
+        std::cerr << "--crowd " << crowd << " exceeds the registry capacity, using "
+                  << EntityRegistry::CAPACITY << "\n";
+      }
+      config.crowdSize = static_cast<uint32_t>(std::min<unsigned long>(crowd, EntityRegistry::CAPACITY));
+    }
+    else if (std::strcmp(argv[i], "--churn") == 0 && i + 1 < argc) {
+      config.churnPerFrame = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    }
+    else if (std::strcmp(argv[i], "--no-pool") == 0) {
+      config.pooling = false;
+    }
+    else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+      config.profileOutput = argv[++i];
+    }
+    else if (std::strcmp(argv[i], "--on-error") == 0 && i + 1 < argc) {
+      const char* mode = argv[++i];
+      if (std::strcmp(mode, "abort") == 0) {
+        ErrorReport::setPolicy(ErrorPolicy::ABORT);
+      }
+      else if (std::strcmp(mode, "log") == 0) {
+        ErrorReport::setPolicy(ErrorPolicy::LOG_AND_CONTINUE);
+      }
+      else if (std::strcmp(mode, "count") == 0) {
+        ErrorReport::setPolicy(ErrorPolicy::COUNT_ONLY);
+      }
+      else {
+        std::cerr << "Unknown error mode: " << mode << "\n";
+        return 1;
+      }
+    }
+    else if (std::strcmp(argv[i], "--archive") == 0 && i + 1 < argc) {
+      config.assetArchive = argv[++i];
+    }
+    else {
+      std::cerr << "Unknown argument: " << argv[i] << "\n";
+      return 1;
+    }
+  }
+  if (config.headless && config.frameCount == 0) {
+    config.frameCount = AppConfig::DEFAULT_HEADLESS_FRAMES;
+  }
+
+  BaseApp app(config);
   return app.run();
-}
\ No newline at end of file
+}